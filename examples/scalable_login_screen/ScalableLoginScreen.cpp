@@ -74,6 +74,11 @@ int main()
     sf::RenderWindow window(sf::VideoMode(400, 300), "TGUI window");
     tgui::Gui gui(window);
 
+    // The text size changes with the window, so let the font draw its glyphs at every size from a single distance field atlas
+    tgui::Font font{gui.getFont()};
+    font.setDistanceFieldRendering(true);
+    gui.setFont(font);
+
     try
     {
         loadWidgets(gui);
@@ -28,6 +28,8 @@
 
 
 #include <list>
+#include <functional>
+#include <unordered_map>
 
 #include <TGUI/Widget.hpp>
 
@@ -35,6 +37,8 @@
 
 namespace tgui
 {
+    class GuiContainer;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Container widget
     ///
@@ -106,6 +110,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const std::vector<Widget::Ptr>& getWidgets() const
         {
+            loadLazyChildren();
             return m_widgets;
         }
 
@@ -118,6 +123,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const std::vector<sf::String>& getWidgetNames() const
         {
+            loadLazyChildren();
             return m_widgetNames;
         }
 
@@ -143,6 +149,8 @@ namespace tgui
         /// The container will first search for widgets that are direct children of it, but when none of the child widgets match
         /// the given name, a recursive search will be performed.
         ///
+        /// When the container is part of a gui and the name is unique, the widget is found in constant time.
+        ///
         /// @return Pointer to the earlier created widget
         ///
         /// @warning This function will return nullptr when an unknown widget name was passed
@@ -291,6 +299,8 @@ namespace tgui
         ///
         /// @param filename  Filename of the widget file
         ///
+        /// The file can also be a binary widget file that was created by calling saveWidgetsToFile with binary set to true.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void loadWidgetsFromFile(const std::string& filename);
 
@@ -299,9 +309,17 @@ namespace tgui
         /// @brief Saves the child widgets to a text file
         ///
         /// @param filename  Filename of the widget file
+        /// @param binary    Save the widgets in a compact binary format instead of as text?
+        ///
+        /// Binary widget files are faster to load, but unlike text files they can't be edited by hand.
+        ///
+        /// The widgets are first written to the file with ".tmp" appended to its name, which then replaces the file.
+        /// When the file can't be replaced, the original file is left unchanged and the temporary file is kept.
+        ///
+        /// @exception Exception when the widgets could not be written or the file could not be replaced
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToFile(const std::string& filename);
+        void saveWidgetsToFile(const std::string& filename, bool binary = false);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -349,6 +367,52 @@ namespace tgui
         void moveWidgetToBack(const Widget::Ptr& widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows the container
+        ///
+        /// Child widgets of which the loading was delayed are loaded the first time the container is shown.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void show() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Delays the loading of the child widgets until they are needed
+        ///
+        /// @param loadFunction  Function that adds the child widgets to the container
+        /// @param widgetNames   Names of all widgets that the function will create, including the ones inside child containers
+        ///
+        /// This is used by the WidgetLoader when lazy loading is enabled. The function is called when the container is shown,
+        /// when its widgets are accessed or when one of the given names is passed to the get function.
+        /// Copies of the container keep the function and call it themselves, so it may be called more than once.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLazyChildren(const std::function<void(Container&)>& loadFunction, std::vector<sf::String> widgetNames);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the child widgets of which the loading was delayed
+        ///
+        /// You don't have to call this function yourself, the widgets are loaded automatically when they are needed.
+        /// The const member functions load them as well, so that the container looks the same whether or not they were loaded.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadLazyChildren() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the loading of the child widgets was delayed and they haven't been loaded yet
+        ///
+        /// @return Are there child widgets that still have to be loaded?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool hasLazyChildren() const
+        {
+            return static_cast<bool>(m_lazyLoadFunction);
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -457,6 +521,36 @@ namespace tgui
         virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the gui container at the root of the widget tree, or nullptr when this container isn't part of a gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GuiContainer* getRootGuiContainer() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes the name of a widget and of all the widgets inside it to the name index of the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void updateNameIndex(GuiContainer& root, const Widget::Ptr& widget, const sf::String& widgetName, bool added);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes only the name of the widget itself to the name index of the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void updateNameIndexEntry(GuiContainer& root, const Widget::Ptr& widget, const sf::String& widgetName, bool added);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes the names of the widgets that the container still has to load to the name index of the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void updateLazyNameIndex(GuiContainer& root, const Container& container, bool added);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Loads the delayed containers inside this container that will create a widget with the given name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadLazyWidgets(GuiContainer& root, const sf::String& widgetName) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -471,6 +565,10 @@ namespace tgui
         // Did we enter handleEvent directly or because we got a MouseReleased event?
         bool m_handingMouseReleased = false;
 
+        // Loads the child widgets of a hidden container when they are first needed, together with the names of those widgets
+        mutable std::function<void(Container&)> m_lazyLoadFunction;
+        mutable std::vector<sf::String> m_lazyWidgetNames;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -536,10 +634,26 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Hash function for the widget names in the name index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct WidgetNameHash
+        {
+            std::size_t operator()(const sf::String& name) const;
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Named widgets anywhere inside the gui, kept up-to-date by the containers when widgets are added, removed or renamed
+        std::unordered_multimap<sf::String, std::weak_ptr<Widget>, WidgetNameHash> m_widgetNameIndex;
+
+        // Names of widgets that haven't been loaded yet, together with the container that will load them
+        std::unordered_multimap<sf::String, std::weak_ptr<Container>, WidgetNameHash> m_lazyWidgetNameIndex;
+
         friend class Gui; // Required to let Gui access protected members from container and Widget
+        friend class Container; // Container maintains the name index
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -0,0 +1,260 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_DISTANCE_FIELD_ATLAS_HPP
+#define TGUI_DISTANCE_FIELD_ATLAS_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/String.hpp>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Texture atlas containing signed distance fields of the glyphs of a font
+    ///
+    /// Every glyph is rasterized only once, at the base character size, and is stored as a distance field in which the alpha
+    /// value of a pixel is the distance to the outline of the glyph (0.5 lies on the outline). Because the outline can be
+    /// reconstructed at any scale, the same glyph can be drawn at every character size, while the font would otherwise store
+    /// a separate set of glyphs for each size. The texture grows when glyphs no longer fit in it, by default up to the largest
+    /// texture supported by the graphics card.
+    ///
+    /// When shaders are supported, the outline is drawn anti-aliased with a small fragment shader. Otherwise the pixels
+    /// outside the outline are discarded with the alpha test of the fixed-function pipeline.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API DistanceFieldAtlas
+    {
+    public:
+
+        /// @brief Glyph stored in the atlas
+        struct Glyph
+        {
+            float advance = 0;         ///< Offset to move horizontally to the next character, at the base character size
+            sf::FloatRect bounds;      ///< Bounding rectangle of the distance field, relative to the baseline, at the base character size
+            sf::FloatRect textureRect; ///< Position of the distance field in the texture of the atlas
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param font                Font of which the glyphs are stored
+        /// @param baseCharacterSize   Character size at which the glyphs are rasterized
+        /// @param spread              Distance in pixels around the outline that is stored in the distance field
+        /// @param maximumTextureSize  Maximum width and height of the texture, or 0 to use the maximum size of the graphics card
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        DistanceFieldAtlas(std::shared_ptr<sf::Font> font, unsigned int baseCharacterSize = 32, unsigned int spread = 4,
+                           unsigned int maximumTextureSize = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a glyph, adding it to the atlas when it wasn't requested before
+        ///
+        /// @param codePoint  Unicode code point of the character
+        /// @param bold       Retrieve the bold version or the regular one?
+        ///
+        /// @return Glyph at the base character size. The glyph has an empty texture rectangle when it doesn't fit in a texture
+        ///         of the maximum size.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Glyph& getGlyph(sf::Uint32 codePoint, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds all characters of a part of a string to the atlas
+        ///
+        /// @param string  String containing the characters
+        /// @param start   Index of the first character to add
+        /// @param length  Amount of characters to add
+        /// @param bold    Add the bold version or the regular one?
+        ///
+        /// The distance fields of the new glyphs are only calculated when the texture is requested, so that the pixels of the
+        /// font texture only have to be downloaded once for all glyphs that were added since the atlas was last drawn.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadGlyphs(const sf::String& string, std::size_t start, std::size_t length, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the character size at which the glyphs are rasterized
+        ///
+        /// @return Base character size
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getBaseCharacterSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the distance around the outline that is stored in the distance field
+        ///
+        /// @return Spread in pixels at the base character size, which is added on every side of the glyph bounds
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getSpread() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the factor with which the glyphs have to be scaled to be drawn at a given character size
+        ///
+        /// @param characterSize  Character size of the text
+        ///
+        /// @return Character size divided by the base character size
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getScale(unsigned int characterSize) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the texture coordinates of a fully opaque part of the texture, used to draw underlines
+        ///
+        /// @return Texture coordinates of an opaque pixel
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2f getSolidTexCoords() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of glyphs in the atlas
+        ///
+        /// @return Number of rasterized glyphs
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getGlyphCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the texture containing the distance fields of the glyphs
+        ///
+        /// @return Texture of the atlas, updated with the glyphs that were added since the last call
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Texture& getTexture();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the texture containing the glyphs
+        ///
+        /// @return Size of the texture, which never exceeds the maximum texture size passed to the constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2u getTextureSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws vertices that use the texture of this atlas
+        ///
+        /// @param target       Render target to draw to
+        /// @param vertices     Vertices of the glyphs, which should all have the same color
+        /// @param vertexCount  Amount of vertices
+        /// @param states       Current render states
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount, sf::RenderStates states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reserves space in the image for a rectangle of the given size, making the image larger when needed.
+        // Returns false when the rectangle doesn't fit in an image of the maximum size.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool allocateRect(unsigned int width, unsigned int height, sf::Vector2u& position);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the size of the image while keeping its contents in the top left corner
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resizeImage(unsigned int width, unsigned int height);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reserves space for a glyph that was rasterized by the font, its distance field is calculated when the texture is needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addGlyph(Glyph& glyph, const sf::Glyph& fontGlyph);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the distance field of a glyph in the image, using the pixels that were downloaded from the font texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void renderDistanceField(const sf::Vector2u& position, const sf::IntRect& rect, const sf::Image& fontImage);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Offset
+        {
+            int x;
+            int y;
+            float distance;
+        };
+
+        std::shared_ptr<sf::Font> m_font;
+        unsigned int m_baseCharacterSize;
+        unsigned int m_spread;
+        unsigned int m_maximumTextureSize;
+
+        std::unordered_map<sf::Uint64, Glyph> m_glyphs; // Key is the code point times two, plus one when bold
+        std::vector<Offset> m_offsets; // Pixel offsets within the spread, sorted on distance
+
+        // Glyphs of which the distance field still has to be calculated: position in the image and rectangle in the font texture
+        std::vector<std::pair<sf::Vector2u, sf::IntRect>> m_pendingGlyphs;
+
+        sf::Image m_image; // Contents of the texture, the texture is only updated from it and never read back
+        sf::Texture m_texture;
+        bool m_textureNeedsUpdate = true;
+
+        sf::Shader m_shader;
+        bool m_shaderLoaded = false; // Whether loading the shader was attempted
+        bool m_shaderAvailable = false;
+
+        // Glyphs are placed next to each other on rows (shelves) that are as high as the highest glyph on them.
+        // When the image becomes wider, the new shelves are placed in a column to the right of the existing ones.
+        unsigned int m_shelfLeft = 0;
+        unsigned int m_shelfTop = 0;
+        unsigned int m_shelfHeight = 0;
+        unsigned int m_shelfRight = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_DISTANCE_FIELD_ATLAS_HPP
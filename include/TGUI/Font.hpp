@@ -27,6 +27,7 @@
 #define TGUI_FONT_HPP
 
 #include <TGUI/Config.hpp>
+#include <TGUI/DistanceFieldAtlas.hpp>
 #include <SFML/Graphics/Font.hpp>
 #include <string>
 #include <cstddef>
@@ -152,6 +153,23 @@ namespace tgui
         const sf::Glyph& getGlyph(sf::Uint32 codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the horizontal offset to apply to move from the given character to the next one
+        ///
+        /// @param codePoint     Unicode code point of the character
+        /// @param characterSize Size of the characters
+        /// @param bold          Retrieve the advance of the bold version or the regular one?
+        ///
+        /// @return Advance of the glyph, in pixels
+        ///
+        /// The advances are cached by the font (and shared by all copies of this object), which makes this function a lot
+        /// faster than getGlyph when only the width of the character is needed. Latin-1 characters are stored in an array
+        /// per character size while other characters are stored in a hash table.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getGlyphAdvance(sf::Uint32 codePoint, unsigned int characterSize, bool bold) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the kerning offset of two glyphs
         ///
@@ -165,6 +183,8 @@ namespace tgui
         ///
         /// @return Kerning value for \a first and \a second, in pixels
         ///
+        /// The kerning of every pair of characters is only requested from the font once, afterwards it is taken from a cache.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         float getKerning(sf::Uint32 first, sf::Uint32 second, unsigned int characterSize) const;
 
@@ -182,10 +202,53 @@ namespace tgui
         float getLineSpacing(unsigned int characterSize) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether texts using this font are drawn from a distance field atlas
+        ///
+        /// @param enabled  Should the glyphs be rasterized once and scaled to every character size?
+        ///
+        /// By default, the glyphs are rasterized separately for every character size that is used, which gives the sharpest
+        /// result but makes the font texture grow with every new size. With distance field rendering, the glyphs are stored
+        /// once in a DistanceFieldAtlas and are drawn from there at any character size, which is recommended
+        /// when texts are continuously resized (e.g. when the text size depends on the size of the window).
+        ///
+        /// This setting is shared by all Font objects that use the same sf::Font and should be changed before the font is used
+        /// by widgets.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDistanceFieldRendering(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether texts using this font are drawn from a distance field atlas
+        ///
+        /// @return Is distance field rendering enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDistanceFieldRendering() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the atlas from which the glyphs are drawn when distance field rendering is enabled
+        ///
+        /// @return Distance field atlas of the font, or nullptr when distance field rendering is disabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<DistanceFieldAtlas> getDistanceFieldAtlas() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        struct GlyphMetrics;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the metrics that are used by other Font objects with the same sf::Font, or creates them when there are none
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<GlyphMetrics> getMetrics(const std::shared_ptr<sf::Font>& font);
+
         std::shared_ptr<sf::Font> m_font;
+        std::shared_ptr<GlyphMetrics> m_metrics; // Cached advances, kernings and distance field atlas, shared between fonts using the same sf::Font
         std::string m_id;
     };
 
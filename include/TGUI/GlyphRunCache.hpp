@@ -0,0 +1,147 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_GLYPH_RUN_CACHE_HPP
+#define TGUI_GLYPH_RUN_CACHE_HPP
+
+
+#include <TGUI/Font.hpp>
+#include <TGUI/TextStyle.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/String.hpp>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Shares the glyph geometry between texts that display the same string
+    ///
+    /// A glyph run contains the vertices of all glyphs of a string, positioned relative to the top-left corner of the text and
+    /// colored in the color of the text. Texts with the same font, character size, style, color and string use the same run and
+    /// only apply their own transform when drawing it. The least recently used runs are removed when the memory limit is exceeded.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API GlyphRunCache
+    {
+    public:
+
+        /// @brief Vertices of the glyphs of a text, two triangles per glyph
+        using GlyphRun = std::vector<sf::Vertex>;
+
+        /// @brief Information about the usage of the cache
+        struct Statistics
+        {
+            std::size_t runCount = 0;    ///< Amount of glyph runs that are currently cached
+            std::size_t memoryUsage = 0; ///< Estimated amount of bytes used by the cached runs
+            std::size_t hits = 0;        ///< Amount of requested runs that were found in the cache
+            std::size_t misses = 0;      ///< Amount of requested runs that had to be created
+            std::size_t evictions = 0;   ///< Amount of runs that were removed because the memory limit was exceeded
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the glyph run of a text, creating it when it isn't cached yet
+        ///
+        /// @param font           Font of the text
+        /// @param characterSize  Character size of the text
+        /// @param style          Style of the text
+        /// @param string         The text itself
+        /// @param color          Color of the vertices, with the opacity of the text already applied
+        ///
+        /// @return Vertices of the text. The run stays valid when it is removed from the cache.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<const GlyphRun> getGlyphRun(const Font& font, unsigned int characterSize, TextStyle style, const sf::String& string,
+                                                           sf::Color color = sf::Color::White);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Generates the vertices of a part of a string, the same way as sf::Text does it
+        ///
+        /// When distance field rendering is enabled in the font, the glyphs are taken from its DistanceFieldAtlas instead of the
+        /// font texture of the character size.
+        ///
+        /// @param vertices       Vertex array to which the glyphs are added
+        /// @param font           Font of the text
+        /// @param characterSize  Character size of the text
+        /// @param style          Style of the text
+        /// @param string         String containing the text
+        /// @param start          Index of the first character of the text in the string
+        /// @param length         Amount of characters in the text
+        /// @param position       Position of the top-left corner of the text
+        /// @param color          Color of the vertices
+        ///
+        /// @return Horizontal position behind the last character
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static float appendGlyphs(GlyphRun& vertices, const Font& font, unsigned int characterSize, TextStyle style, const sf::String& string,
+                                  std::size_t start, std::size_t length, sf::Vector2f position, sf::Color color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of memory that the cached runs may use
+        ///
+        /// @param bytes  Maximum amount of bytes, the default is 4 MB
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setMemoryLimit(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory that the cached runs may use
+        ///
+        /// @return Maximum amount of bytes
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getMemoryLimit();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns information about the usage of the cache
+        ///
+        /// @return Current size of the cache and the amount of hits, misses and evictions since the last call to clear()
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Statistics getStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all runs from the cache and resets the statistics
+        ///
+        /// Texts that are still using a run keep it alive until they no longer need it.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clear();
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_GLYPH_RUN_CACHE_HPP
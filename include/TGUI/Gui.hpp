@@ -360,6 +360,8 @@ namespace tgui
         ///
         /// @param filename  Filename of the widget file
         ///
+        /// The file can also be a binary widget file that was created by calling saveWidgetsToFile with binary set to true.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void loadWidgetsFromFile(const std::string& filename);
 
@@ -368,9 +370,12 @@ namespace tgui
         /// @brief Saves the child widgets to a text file
         ///
         /// @param filename  Filename of the widget file
+        /// @param binary    Save the widgets in a compact binary format instead of as text?
+        ///
+        /// Binary widget files are faster to load, but unlike text files they can't be edited by hand.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToFile(const std::string& filename);
+        void saveWidgetsToFile(const std::string& filename, bool binary = false);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
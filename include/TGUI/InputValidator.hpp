@@ -0,0 +1,181 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_INPUT_VALIDATOR_HPP
+#define TGUI_INPUT_VALIDATOR_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+#include <array>
+#include <regex>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Regular expression that is compiled into a deterministic automaton to validate text
+    ///
+    /// The pattern uses the ECMAScript syntax of std::regex and is matched against the unicode code points of the text.
+    /// Characters, escapes, character classes, groups, alternatives and quantifiers are supported. Patterns that can't be
+    /// expressed with a finite automaton (e.g. back-references, lookaheads or word boundaries) are matched with std::regex on
+    /// the ANSI version of the text instead.
+    ///
+    /// The automaton only needs a single state to remember how far it got in the text, so someone who keeps the state after
+    /// the first characters of a text can check a character that is appended to them in constant time.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API InputValidator
+    {
+    public:
+
+        using State = unsigned int;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor that compiles the pattern
+        ///
+        /// @param pattern  Regular expression that the entire text has to match
+        ///
+        /// @throw std::regex_error when the pattern is not a valid regular expression
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InputValidator(const std::string& pattern = ".*");
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the pattern that was passed to the constructor
+        ///
+        /// @return Regular expression that the text is matched against
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::string& getPattern() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the pattern was compiled into an automaton
+        ///
+        /// @return True when the state functions can be used, false when the text can only be checked with the match function
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCompiled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the state of the automaton before any character was read
+        ///
+        /// @return Initial state
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        State getStartState() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the state of the automaton after reading a character
+        ///
+        /// @param state      State before reading the character
+        /// @param codePoint  Unicode character to read
+        ///
+        /// @return State after reading the character
+        ///
+        /// This function may only be called when isCompiled() returns true.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        State getNextState(State state, sf::Uint32 codePoint) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the state of the automaton after reading the characters of a text
+        ///
+        /// @param state  State before reading the text
+        /// @param text   Text to read
+        /// @param start  Index of the first character in the text to read
+        ///
+        /// @return State after reading the characters from start until the end of the text
+        ///
+        /// This function may only be called when isCompiled() returns true.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        State getNextState(State state, const sf::String& text, std::size_t start = 0) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the text that lead to the given state matches the pattern
+        ///
+        /// @param state  State of the automaton after reading the text
+        ///
+        /// @return Is the text read so far valid?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isAccepting(State state) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the entire text matches the pattern
+        ///
+        /// @param text  Text to validate
+        ///
+        /// @return Does the text match the pattern?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool match(const sf::String& text) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Returns the index of the character range in which the code point lies
+        std::size_t findCharacterClass(sf::Uint32 codePoint) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::string m_pattern;
+        bool m_compiled = false;
+
+        // Only used when the pattern could not be compiled
+        std::regex m_regex;
+
+        // The code points are divided in ranges that are treated identically by the pattern, m_classStarts contains the
+        // first code point of each range. Characters from the ASCII range are looked up directly in m_asciiClasses.
+        std::vector<sf::Uint32> m_classStarts;
+        std::array<unsigned int, 128> m_asciiClasses;
+
+        // Transition table with a row per state and a column per character range. State 0 is the state from which the text
+        // can never become valid again, state 1 is the start state.
+        std::vector<State> m_transitions;
+        std::vector<bool> m_accepting;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_INPUT_VALIDATOR_HPP
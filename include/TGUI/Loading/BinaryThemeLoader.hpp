@@ -0,0 +1,186 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BINARY_THEME_LOADER_HPP
+#define TGUI_BINARY_THEME_LOADER_HPP
+
+
+#include <TGUI/Loading/ThemeLoader.hpp>
+#include <cstdint>
+#include <mutex>
+#include <set>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Theme loader for themes that were compiled to a binary file
+    ///
+    /// A theme file can be compiled with the compile function (or the tgui-theme-compiler tool). The binary file contains
+    /// the sections of the theme with their references already resolved, so loading it requires no parsing of the text.
+    /// The file is memory-mapped when it is first used and remains mapped until the loader is destroyed or the cache flushed.
+    /// Files can be preloaded on another thread while the loader is being used.
+    ///
+    /// The filenames of textures are stored relative to the binary file, which should thus be placed next to the images.
+    ///
+    /// @code
+    /// tgui::Theme::setThemeLoader(std::make_shared<tgui::BinaryThemeLoader>());
+    /// tgui::Theme theme{"widgets/Black.tgt"};
+    /// @endcode
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BinaryThemeLoader : public BaseThemeLoader
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        BinaryThemeLoader();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor, unmaps the loaded files
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~BinaryThemeLoader();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Maps the binary theme file in memory
+        ///
+        /// @param filename  Filename of the binary theme file to load
+        ///
+        /// @exception Exception when the file could not be opened or is not a valid binary theme file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void preload(const std::string& filename) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the binary theme file
+        ///
+        /// @param filename   Filename of the binary theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// Nested renderers are returned in the same text form as the DefaultThemeLoader returns them.
+        /// Use loadRenderer to get them without having to parse them again.
+        ///
+        /// @return Map of property-value pairs, which remains valid for as long as the loader exists
+        ///
+        /// @exception Exception when the file is not a valid binary theme file
+        /// @exception Exception when file did not contain requested section
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual const std::map<sf::String, sf::String>& load(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the binary theme file as values that can be put in a renderer
+        ///
+        /// @param filename   Filename of the binary theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// The renderer data is created the first time the section is loaded and is shared by all callers until one of them
+        /// changes it.
+        ///
+        /// @return Copy-on-write renderer data containing the property-value pairs, with nested sections stored as renderer data
+        ///
+        /// @exception Exception when the file is not a valid binary theme file
+        /// @exception Exception when file did not contain requested section
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::shared_ptr<RendererData> loadRenderer(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the names of all sections in the binary theme file
+        ///
+        /// @param filename  Filename of the binary theme file
+        ///
+        /// @return Lowercase names of the sections in the file
+        ///
+        /// @exception Exception when the file is not a valid binary theme file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::vector<std::string> getSectionNames(const std::string& filename) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Unmaps files and forces them to be loaded again
+        ///
+        /// @param filename  File to remove from cache.
+        ///                  If no filename is given, the entire cache is cleared.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushCache(const std::string& filename = "");
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compiles a text theme file into a binary theme file
+        ///
+        /// @param themeFilename   Filename of the theme file to compile
+        /// @param outputFilename  Filename of the binary file to create
+        ///
+        /// @exception Exception when the theme file could not be loaded or the output file could not be written
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void compile(const std::string& themeFilename, const std::string& outputFilename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct ThemeFile;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the loaded file, loading it first when it isn't in cache yet.
+        // The file remains mapped while the returned pointer is kept, even when the cache is flushed in the meantime.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<ThemeFile> getThemeFile(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the renderer data that is stored at the given index in the file, creating it when it is first requested.
+        // The mutex has to be locked when calling this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<RendererData> createRendererData(ThemeFile& file, std::uint32_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::map<std::string, std::shared_ptr<ThemeFile>> m_themeFiles;
+        std::set<std::map<sf::String, sf::String>> m_loadedProperties; // Returned by load, kept when the cache is flushed
+        std::mutex m_mutex; // Protects m_themeFiles, m_loadedProperties and the caches of the files
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BINARY_THEME_LOADER_HPP
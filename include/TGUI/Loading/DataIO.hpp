@@ -86,14 +86,72 @@ namespace tgui
         static std::unique_ptr<Node> parse(std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file that is stored in memory
+        ///
+        /// @param data  Pointer to the contents of the widget file, which don't have to be null-terminated
+        /// @param size  Amount of bytes in the data
+        ///
+        /// The input is tokenized directly from the given buffer, no copy of the data is made.
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<Node> parse(const char* data, std::size_t size);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emits the widget file
         ///
-        /// @param rootNode Root node of the tree of nodes that is to be converted to a string stream
+        /// @param rootNode Root node of the tree of nodes that is to be written to the stream
         /// @param stream   Stream to which the widget file will be added
         ///
+        /// The nodes are written directly to the stream while the tree is being traversed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void emit(const std::unique_ptr<Node>& rootNode, std::ostream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file that was stored in the binary format
+        ///
+        /// @param data  Pointer to the contents of the binary widget file
+        /// @param size  Amount of bytes in the data
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// @exception Exception when the data is not a valid binary widget file or when its nodes are nested more than 256 levels deep
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<Node> parseBinary(const char* data, std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the widget file in a compact binary format
+        ///
+        /// @param rootNode Root node of the tree of nodes that is to be written to the stream
+        /// @param stream   Stream to which the binary widget file will be written, which should be opened in binary mode
+        ///
+        /// Names and values that occur multiple times are only stored once in the file. Parsing the binary file with parseBinary
+        /// results in the same tree as parsing the output of the emit function with parse. Values are stored as UTF-8, so unlike
+        /// in the text form, characters outside the ANSI range are kept.
+        ///
+        /// @exception Exception when the nodes are nested more than 256 levels deep
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void emitBinary(const std::unique_ptr<Node>& rootNode, std::ostream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the data starts with the header of a binary widget file
+        ///
+        /// @param data  Pointer to the contents of the widget file
+        /// @param size  Amount of bytes in the data
+        ///
+        /// @return True when the data should be parsed with parseBinary, false when it should be parsed with parse
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static void emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+        static bool isBinary(const char* data, std::size_t size);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
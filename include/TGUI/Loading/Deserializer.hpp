@@ -28,6 +28,7 @@
 
 
 #include <TGUI/ObjectConverter.hpp>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -36,6 +37,14 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Deserializes a settable property
     ///
+    /// Values of immutable types (fonts, colors, strings, numbers, layouts, outlines and text styles) are memoized: every
+    /// distinct serialized string is only parsed once and later requests for the same string return a copy of the cached value.
+    /// Fonts loaded this way are thus shared between all widgets that use the same font file.
+    /// Textures are not cached as the TextureManager already shares their image data, renderer data is never cached because
+    /// the returned object is meant to be modified.
+    /// At most 1000 values are cached per type, the values of a type are discarded when its cache becomes full.
+    /// Cached fonts are discarded when a resource pack is mounted or unmounted.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API Deserializer
     {
@@ -44,14 +53,89 @@ namespace tgui
 
         static ObjectConverter deserialize(ObjectConverter::Type type, const std::string& serializedString);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the function used to deserialize a certain type
+        ///
+        /// @param type          Type of the property that should be deserialized with the new function
+        /// @param deserializer  Function that turns the serialized string into the property value
+        ///
+        /// Previously cached values for this type are discarded.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void setFunction(ObjectConverter::Type type, const DeserializeFunc& deserializer);
         static const DeserializeFunc& getFunction(ObjectConverter::Type type);
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether deserialized values are memoized
+        ///
+        /// @param enabled  Should deserialized values be cached? The cache is enabled by default.
+        ///
+        /// Disabling the cache also clears it.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setCacheEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether deserialized values are memoized
+        ///
+        /// @return Is the cache enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isCacheEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all cached values and resets the hit and miss counters
+        ///
+        /// Call this when resources have changed on disk or when fonts kept alive by the cache should be released.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the cached values of a single type
+        ///
+        /// @param type  Type of which the cached values should be discarded
+        ///
+        /// The hit and miss counters are not reset by this function.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearCache(ObjectConverter::Type type);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times a value was found in the cache since it was last cleared
+        ///
+        /// @return Amount of cache hits
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getCacheHits();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many cacheable values had to be deserialized since the cache was last cleared
+        ///
+        /// @return Amount of cache misses
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getCacheMisses();
+
     public:
         static std::vector<std::string> split(const std::string& str, char delim);
 
+    private:
+        static bool isCacheable(ObjectConverter::Type type);
+
     private:
         static std::map<ObjectConverter::Type, DeserializeFunc> m_deserializers;
+
+        static std::map<ObjectConverter::Type, std::unordered_map<std::string, ObjectConverter>> m_cache;
+        static bool m_cacheEnabled;
+        static std::size_t m_cacheHits;
+        static std::size_t m_cacheMisses;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
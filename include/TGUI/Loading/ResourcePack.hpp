@@ -0,0 +1,213 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_RESOURCE_PACK_HPP
+#define TGUI_RESOURCE_PACK_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <unordered_map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Single file that contains many resources (themes, forms, images and fonts) together with an index
+    ///
+    /// The pack is memory-mapped when it is opened, looking up a file in it doesn't access the disk.
+    /// Once a pack is mounted, the theme loaders, loadWidgetsFromFile, the default image loader of Texture and the font
+    /// deserializer first look for the requested file inside the mounted packs and only open the file from disk when
+    /// no pack contains it.
+    ///
+    /// Files inside a pack are always identified by their name relative to the resource path (see setResourcePath). This is
+    /// the name that is passed to create and the filename that is given to the theme, loadWidgetsFromFile or a font property.
+    /// Filenames that start with the resource path, like the filenames of textures, are looked up without that part.
+    ///
+    /// @code
+    /// tgui::ResourcePack::create("resources.tgp", {"widgets/Black.txt", "widgets/Black.png", "form.txt"});
+    ///
+    /// tgui::ResourcePack::mount(std::make_shared<tgui::ResourcePack>("resources.tgp"));
+    /// tgui::Theme theme{"widgets/Black.txt"};
+    /// gui.loadWidgetsFromFile("form.txt");
+    /// @endcode
+    ///
+    /// Packs can be mounted and unmounted while resources are being loaded on another thread. A file that was already found
+    /// keeps its pack alive until it has been loaded, even when the pack is unmounted in the meantime.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ResourcePack
+    {
+    public:
+
+        typedef std::shared_ptr<ResourcePack> Ptr; ///< Shared resource pack pointer
+        typedef std::shared_ptr<const ResourcePack> ConstPtr; ///< Shared constant resource pack pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Opens a resource pack and maps it in memory
+        ///
+        /// @param filename  Filename of the pack, relative to the resource path
+        ///
+        /// @exception Exception when the file could not be opened or is not a valid resource pack
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ResourcePack(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor, unmaps the file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~ResourcePack();
+
+
+        ResourcePack(const ResourcePack&) = delete;
+        ResourcePack& operator=(const ResourcePack&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the contents of a file inside the pack
+        ///
+        /// @param filename  Name of the file inside the pack
+        /// @param size      Set to the size of the file when it was found
+        ///
+        /// @return Pointer to the contents of the file, or nullptr when the pack doesn't contain the file.
+        ///         The pointer remains valid for as long as the pack exists.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const char* getFile(const std::string& filename, std::size_t& size) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the pack contains a certain file
+        ///
+        /// @param filename  Name of the file inside the pack
+        ///
+        /// @return Is the file part of the pack?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool contains(const std::string& filename) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the names of all files in the pack
+        ///
+        /// @return Names of the files, in the order in which they are stored
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::string> getFilenames() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a resource pack from files on disk
+        ///
+        /// @param outputFilename  Filename of the pack to create, relative to the resource path
+        /// @param filenames       Files to put inside the pack, relative to the resource path.
+        ///                        They are stored under the same name, so they can later be loaded with the same filename
+        ///                        even when the resource path is changed in the meantime.
+        ///
+        /// @exception Exception when one of the files could not be read or the pack could not be written
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void create(const std::string& outputFilename, const std::vector<std::string>& filenames);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes the files inside the pack available to the loading functions
+        ///
+        /// @param pack        The pack to mount
+        /// @param mountPoint  Directory in which the files of the pack should appear, relative to the resource path
+        ///
+        /// When several mounted packs contain the same file, the pack that was mounted last is used.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void mount(const ConstPtr& pack, const std::string& mountPoint = "");
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Unmounts a pack
+        ///
+        /// @param pack  The pack to unmount
+        ///
+        /// Resources that were already loaded from the pack remain valid.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void unmount(const ConstPtr& pack);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Unmounts all packs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void unmountAll();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Looks for a file inside the mounted packs
+        ///
+        /// @param filename  Filename relative to the resource path. When the filename starts with the resource path,
+        ///                  then that part is ignored, so the full filename that would be opened from disk can be passed too.
+        /// @param data      Set to the contents of the file when it was found
+        /// @param size      Set to the size of the file when it was found
+        ///
+        /// @return The pack that contains the file, which has to be kept alive for as long as the data is used.
+        ///         Returns nullptr when none of the mounted packs contains the file.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ConstPtr findMountedFile(const std::string& filename, const char*& data, std::size_t& size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        void unmap();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        const char* m_data = nullptr;
+        std::size_t m_size = 0;
+
+    #ifdef SFML_SYSTEM_WINDOWS
+        void* m_fileHandle = nullptr;
+        void* m_mappingHandle = nullptr;
+    #endif
+
+        std::vector<std::string> m_filenames;
+        std::unordered_map<std::string, std::pair<std::size_t, std::size_t>> m_index; // Offset and size of each file
+
+        static std::vector<std::pair<std::string, ConstPtr>> m_mountedPacks; // Mount point and pack
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RESOURCE_PACK_HPP
@@ -28,6 +28,7 @@
 
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <future>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -62,6 +63,18 @@ namespace tgui
         void load(const std::string& primary);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many renderer properties were changed by the last call to the load function
+        ///
+        /// @return Number of properties that were added, removed or given a different value, summed over all renderers
+        ///
+        /// Only these properties are passed to the widgets that use the renderers. Properties of which the serialized
+        /// value is identical in the old and the new theme are left untouched.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getChangedPropertyCount() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets data for the renderers
         ///
@@ -115,12 +128,38 @@ namespace tgui
         static std::shared_ptr<BaseThemeLoader> getThemeLoader();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a theme and decodes all images that it uses on worker threads
+        ///
+        /// @param primary  Primary parameter for the theme loader (filename of the theme file in DefaultThemeLoader)
+        ///
+        /// The theme is parsed by the current theme loader, after which the images of the textures are decoded on a pool of
+        /// threads and the fonts are loaded in the cache of the Deserializer. Once the returned future is ready, constructing
+        /// a Theme with the same parameter no longer has to read any file and applying its renderers to widgets only has to
+        /// upload the textures, which still happens on the thread that uses them.
+        ///
+        /// @code
+        /// auto themeReady = tgui::Theme::preloadAsync("widgets/Black.txt");
+        /// // ... do other work ...
+        /// themeReady.get(); // Rethrows any exception that occurred while parsing the theme or loading its resources
+        /// tgui::Theme theme{"widgets/Black.txt"};
+        /// @endcode
+        ///
+        /// The theme loader and image loader should not be changed while the theme is being preloaded.
+        ///
+        /// @return Future that becomes ready when the theme and its images are loaded
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::future<void> preloadAsync(const std::string& primary);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         static std::shared_ptr<BaseThemeLoader> m_themeLoader;  ///< Theme loader which will do the actual loading
         std::map<std::string, std::shared_ptr<RendererData>> m_renderers; ///< Maps ids to renderer datas
         std::string m_primary;
+        std::size_t m_changedPropertyCount = 0;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
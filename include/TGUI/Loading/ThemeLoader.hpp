@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Config.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <SFML/System/String.hpp>
 #include <memory>
 #include <string>
@@ -71,10 +72,45 @@ namespace tgui
         ///
         /// @return Map op property-value pairs
         ///
+        /// The loader may be used on several threads, so the returned map has to stay valid for as long as the loader exists,
+        /// even when the cache of the loader is flushed while the caller is still using the properties.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual const std::map<sf::String, sf::String>& load(const std::string& primary, const std::string& secondary) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the theme as values that can be put in a renderer
+        ///
+        /// @param primary    Primary parameter of the loader
+        /// @param secondary  Secondary parameter of the loader
+        ///
+        /// The default implementation wraps the strings returned by the load function in ObjectConverter objects.
+        /// Loaders can override it to return values that no longer have to be deserialized, such as nested renderers.
+        ///
+        /// @return Copy-on-write renderer data containing the property-value pairs
+        ///
+        /// The returned data may be shared with everyone else that loads the same section, widgets that are given the data
+        /// copy it before changing it. It should not be changed directly.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::shared_ptr<RendererData> loadRenderer(const std::string& primary, const std::string& secondary);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the names of all sections that can be loaded
+        ///
+        /// @param primary  Primary parameter of the loader
+        ///
+        /// The default implementation returns an empty list, loaders that don't know their sections in advance don't have
+        /// to override it. Theme::preloadAsync uses it to find the textures that are used by the theme.
+        ///
+        /// @return Lowercase names of the sections
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::vector<std::string> getSectionNames(const std::string& primary);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -85,7 +121,9 @@ namespace tgui
     /// Themes are stored on disk in files which contain sections with a syntax similar to CSS.
     /// This loader will be able to extract the data from these files.
     ///
-    /// On first access, the entire file will be cached, the next times the cached map is simply returned.
+    /// On first access, the entire file will be cached as renderer data, the next times the cached data is simply returned.
+    /// The string form of a section that is returned by the load function is only created when it is first requested.
+    /// The cache is protected by a mutex, so files can be preloaded on another thread while the loader is being used.
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API DefaultThemeLoader : public BaseThemeLoader
@@ -109,7 +147,7 @@ namespace tgui
         /// @param filename   Filename of the theme file
         /// @param section    Name of the section inside the theme file
         ///
-        /// @return Map of property-value pairs
+        /// @return Map of property-value pairs, which remains valid when the cache is flushed
         ///
         /// @exception Exception when finding syntax errors in the file
         /// @exception Exception when file did not contain requested class name
@@ -118,6 +156,38 @@ namespace tgui
         virtual const std::map<sf::String, sf::String>& load(const std::string& filename, const std::string& section) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the theme file as values that can be put in a renderer
+        ///
+        /// @param filename   Filename of the theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// The renderer data was created when the file was loaded in cache and is shared by all callers until one of them
+        /// changes it. Nested sections and references to other sections are stored as nested renderer data, a section that
+        /// is referenced several times is shared as well.
+        ///
+        /// @return Copy-on-write renderer data containing the property-value pairs
+        ///
+        /// @exception Exception when finding syntax errors in the file
+        /// @exception Exception when file did not contain requested class name
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::shared_ptr<RendererData> loadRenderer(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the names of all sections in the theme file
+        ///
+        /// @param filename  Filename of the theme file
+        ///
+        /// @return Lowercase names of the sections in the file
+        ///
+        /// @exception Exception when finding syntax errors in the file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::vector<std::string> getSectionNames(const std::string& filename) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Empties the caches and force files to be reloaded.
         ///
@@ -143,9 +213,10 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
-        static std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> m_propertiesCache;
+        static std::map<std::string, std::map<std::string, const std::map<sf::String, sf::String>*>> m_propertiesCache; // Filled by load
+        static std::map<std::string, std::map<std::string, std::shared_ptr<RendererData>>> m_renderersCache; // Filled by preload
 
-        friend struct DefaultThemeLoaderTest; // Used for testing m_propertiesCache
+        friend struct DefaultThemeLoaderTest; // Used for testing the caches
     };
 
 
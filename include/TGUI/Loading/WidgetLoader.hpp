@@ -57,6 +57,22 @@ namespace tgui
         static void load(Container::Ptr parent, std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a container and its child widgets from a widget file that is stored in memory
+        ///
+        /// @param parent  The parent container for the child widget
+        /// @param data    Pointer to the contents of the widget file
+        /// @param size    Amount of bytes in the data
+        ///
+        /// The data can either be a text widget file or a binary widget file created with WidgetSaver::saveBinary.
+        ///
+        /// @note You should use the loadWidgetsFromFile or loadWidgetsFromSteam functions in Gui and Container
+        ///       instead of calling this function directly.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void load(Container::Ptr parent, const char* data, std::size_t size);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the load function for a certain widget type
         ///
@@ -78,9 +94,43 @@ namespace tgui
         static const LoadFunction& getLoadFunction(const std::string& type);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the widgets inside hidden containers are only loaded when they are needed
+        ///
+        /// @param lazyLoading  Delay loading the widgets inside containers that are hidden in the widget file?
+        ///
+        /// When enabled, the parsed child widgets of a container with "Visible = false" are kept until the container is shown,
+        /// until its widgets are accessed or until one of their names is passed to the get function of the container or gui.
+        /// Errors in that part of the widget file are then also only reported at that moment.
+        ///
+        /// Lazy loading is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setLazyLoading(bool lazyLoading);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the widgets inside hidden containers are only loaded when they are needed
+        ///
+        /// @return Is lazy loading enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool getLazyLoading();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the widgets from the parsed widget file to the container
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void loadWidgetsFromNode(const Container::Ptr& parent, const std::unique_ptr<DataIO::Node>& rootNode);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
         static std::map<std::string, LoadFunction> m_loadFunctions;
+        static bool m_lazyLoading;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
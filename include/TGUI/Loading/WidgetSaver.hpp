@@ -54,7 +54,22 @@ namespace tgui
         ///       instead of calling this function directly.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static void save(Container::ConstPtr widget, std::stringstream& stream);
+        static void save(Container::ConstPtr widget, std::ostream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves a container and its child widgets to a stream in a compact binary format
+        ///
+        /// @param widget  The container to save
+        /// @param stream  Stream to which the binary widget file will be written to, which should be opened in binary mode
+        ///
+        /// Loading the binary file results in the same widgets as loading the file that is written by the save function,
+        /// but it requires less work when loading.
+        ///
+        /// @note You should use the saveWidgetsToFile function in Gui and Container instead of calling this function directly.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void saveBinary(Container::ConstPtr widget, std::ostream& stream);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -78,6 +93,15 @@ namespace tgui
         static const SaveFunction& getSaveFunction(const std::string& type);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the root node containing the nodes of all child widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<DataIO::Node> saveWidgetsToNode(const Container::ConstPtr& widget);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
         static std::map<std::string, SaveFunction> m_saveFunctions;
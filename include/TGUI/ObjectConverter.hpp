@@ -32,7 +32,7 @@
 #include <TGUI/Texture.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/Font.hpp>
-#include <TGUI/Any.hpp>
+#include <memory>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -43,6 +43,9 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Implicit converter for settable properties
     ///
+    /// The value is stored inside the object itself (a union of the supported types), so storing, copying and retrieving
+    /// a value does not require a memory allocation unless the stored type itself allocates (e.g. the id of a texture).
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API ObjectConverter
     {
@@ -80,7 +83,6 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ObjectConverter(const sf::String& string)  :
             m_type      {Type::String},
-            m_value     {string},
             m_serialized{true},
             m_string    {string}
         {
@@ -94,8 +96,8 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ObjectConverter(Font font) :
-            m_type {Type::Font},
-            m_value{font}
+            m_type{Type::Font},
+            m_font{std::move(font)}
         {
         }
 
@@ -120,7 +122,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ObjectConverter(Color color) :
             m_type {Type::Color},
-            m_value{color}
+            m_color{color}
         {
         }
 
@@ -132,8 +134,8 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ObjectConverter(float number) :
-            m_type {Type::Number},
-            m_value{number}
+            m_type  {Type::Number},
+            m_number{number}
         {
         }
 
@@ -145,8 +147,8 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ObjectConverter(const Layout& layout) :
-            m_type {Type::Layout},
-            m_value{layout}
+            m_type  {Type::Layout},
+            m_layout{layout}
         {
         }
 
@@ -158,8 +160,8 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ObjectConverter(const Outline& outline) :
-            m_type {Type::Outline},
-            m_value{outline}
+            m_type   {Type::Outline},
+            m_outline{outline}
         {
         }
 
@@ -171,8 +173,8 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ObjectConverter(const Texture& texture) :
-            m_type {Type::Texture},
-            m_value{texture}
+            m_type   {Type::Texture},
+            m_texture{texture}
         {
         }
 
@@ -198,8 +200,8 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ObjectConverter(TextStyle style) :
-            m_type {Type::TextStyle},
-            m_value{style}
+            m_type     {Type::TextStyle},
+            m_textStyle{style}
         {
         }
 
@@ -211,12 +213,47 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ObjectConverter(std::shared_ptr<RendererData> data) :
-            m_type {Type::RendererData},
-            m_value{std::move(data)}
+            m_type    {Type::RendererData},
+            m_renderer{std::move(data)}
         {
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter(const ObjectConverter& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter(ObjectConverter&& other) noexcept;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~ObjectConverter();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of copy assignment operator
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& operator=(const ObjectConverter& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of move assignment operator
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& operator=(ObjectConverter&& other) noexcept;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves the saved string
         ///
@@ -323,10 +360,43 @@ namespace tgui
         Type getType() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructs the value of the other object in the union, the union must not contain a value yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void copyValue(const ObjectConverter& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the value of the other object in the union, the union must not contain a value yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void moveValue(ObjectConverter&& other) noexcept;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Destroys the value stored in the union
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void destroyValue();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
         Type m_type = Type::None;
-        Any  m_value;
+
+        // Only the member matching m_type is alive. Strings are only stored in m_string.
+        union
+        {
+            Font      m_font;
+            Color     m_color;
+            float     m_number;
+            Layout    m_layout;
+            Outline   m_outline;
+            Texture   m_texture;
+            TextStyle m_textStyle;
+            std::shared_ptr<RendererData> m_renderer;
+        };
 
         bool m_serialized = false;
         sf::String m_string;
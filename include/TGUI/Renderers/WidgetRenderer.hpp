@@ -29,6 +29,7 @@
 
 #include <TGUI/Config.hpp>
 #include <TGUI/ObjectConverter.hpp>
+#include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -48,8 +49,41 @@ namespace tgui
             return data;
         }
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates renderer data that can be shared by many widgets and that is only copied when one of them changes it
+        ///
+        /// This is used for the default renderer of each widget type, so that constructing a widget doesn't copy all properties.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<RendererData> createCopyOnWrite(const std::map<std::string, ObjectConverter>& init)
+        {
+            auto data = create(init);
+            data->copyOnWrite = true;
+            return data;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the observers that a property has changed
+        ///
+        /// When an update is in progress, the property is remembered and the observers are only informed when it ends.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void notifyObservers(const std::string& property);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the observers that several properties have changed at once
+        ///
+        /// Observers that subscribed a batch callback get a single call, the others are called once per property.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void notifyObservers(const std::set<std::string>& properties);
+
         std::map<std::string, ObjectConverter> propertyValuePairs;
         std::map<void*, std::function<void(const std::string& property)>> observers;
+        std::map<void*, std::function<void(const std::set<std::string>& properties)>> batchObservers;
+        bool copyOnWrite = false; ///< Data is shared between widgets and has to be copied before it gets changed
+        unsigned int updateDepth = 0; ///< Number of beginUpdate calls that haven't been matched by an endUpdate call yet
+        std::set<std::string> pendingChanges; ///< Properties that were changed while an update was in progress
+
+        /// Shared copies of this data in which only the font was changed, so that widgets inheriting the same font keep sharing data
+        std::vector<std::pair<std::weak_ptr<sf::Font>, std::weak_ptr<RendererData>>> inheritedFontData;
     };
 
 
@@ -78,6 +112,37 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        ///
+        /// The copy will use the same renderer data, but it will not share the subscribed callback functions.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WidgetRenderer(const WidgetRenderer& other)
+        {
+            shareDataWith(other);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of copy assignment operator
+        ///
+        /// The copy will use the same renderer data, but it will not share the subscribed callback functions.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WidgetRenderer& operator=(const WidgetRenderer& other)
+        {
+            if (this != &other)
+            {
+                shareDataWith(other);
+                m_copyOnWriteObservers.clear();
+                m_copyOnWriteBatchObservers.clear();
+            }
+
+            return *this;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Virtual destructor
         ///
@@ -123,6 +188,18 @@ namespace tgui
         Font getFont() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gives the widget the font of its parent
+        ///
+        /// @param font  The font of the parent
+        ///
+        /// This has the same result as setFont, but when the renderer still uses data that is shared with other widgets then it
+        /// switches to data that is shared by all widgets that inherited the same font, instead of making a private copy.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void inheritFont(const Font& font);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes a property of the renderer
         ///
@@ -170,14 +247,45 @@ namespace tgui
         const std::map<std::string, ObjectConverter>& getPropertyValuePairs() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts changing multiple properties at once
+        ///
+        /// Until the matching endUpdate call, changed properties are collected instead of being passed to the subscribed
+        /// callback functions one by one. Calls to beginUpdate and endUpdate can be nested.
+        ///
+        /// @code
+        /// renderer->beginUpdate();
+        /// renderer->setFont("DejaVuSans.ttf");
+        /// renderer->setPadding({5});
+        /// renderer->setBorders({2});
+        /// renderer->endUpdate(); // The widget only recalculates its text once
+        /// @endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finishes changing multiple properties at once
+        ///
+        /// When this ends the outermost update, the subscribed callback functions are informed about all changed properties.
+        /// The update is ended on the data on which beginUpdate was called, even when the renderer got other data in between.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endUpdate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Subscribes a callback function to changes in the renderer
         ///
-        /// @param id       Unique identifier for this callback function so that you can unsubscribe it later
-        /// @param function Callback function to call when the renderer changes
+        /// @param id            Unique identifier for this callback function so that you can unsubscribe it later
+        /// @param function      Callback function to call when the renderer changes
+        /// @param batchFunction Optional callback function to call when several properties were changed together
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void subscribe(void* id, const std::function<void(const std::string& property)>& function);
+        void subscribe(void* id,
+                       const std::function<void(const std::string& property)>& function,
+                       const std::function<void(const std::set<std::string>& properties)>& batchFunction = nullptr);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -204,6 +312,9 @@ namespace tgui
         ///
         /// @return Data that is shared between the renderers
         ///
+        /// When the renderer was still using the default renderer data of the widget, it first gets its own copy of it.
+        /// The returned data can thus be passed to the setRenderer function of other widgets to share it with them.
+        ///
         /// @warning You should not make changed to this data directly. Instead, use the function from the renderer classes
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -222,10 +333,41 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        std::shared_ptr<RendererData> m_data = RendererData::create();
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gives this renderer its own copy of the data if the data was shared copy-on-write (e.g. default widget renderers)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void detachSharedData() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes this renderer use the same data as another renderer, for when a widget is copied.
+        // Changes made through either renderer have to reach the other, so copy-on-write data is first detached from the
+        // other renderer, unless that renderer is the one that owns it (e.g. the widget stored inside a WidgetPrototype).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void shareDataWith(const WidgetRenderer& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        mutable std::shared_ptr<RendererData> m_data = RendererData::create();
+
+        // Callback functions that are subscribed while the data is still shared copy-on-write.
+        // They are only added to the observers of the data once this renderer has its own copy of it.
+        mutable std::map<void*, std::function<void(const std::string& property)>> m_copyOnWriteObservers;
+        mutable std::map<void*, std::function<void(const std::set<std::string>& properties)>> m_copyOnWriteBatchObservers;
+
+        // Is the copy-on-write data owned by this renderer? Copies of the renderer then keep sharing it copy-on-write.
+        // Renderers using the default renderer data of a widget never own it, that data isn't part of any widget.
+        mutable bool m_ownsSharedData = false;
+
+        // Data on which each unfinished beginUpdate call was made, so that endUpdate still finishes it when setData was called
+        std::vector<std::shared_ptr<RendererData>> m_updatedData;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        friend class WidgetPrototype; // WidgetPrototype makes the renderers of its widget the owners of their shared data
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
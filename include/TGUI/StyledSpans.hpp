@@ -0,0 +1,222 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_STYLED_SPANS_HPP
+#define TGUI_STYLED_SPANS_HPP
+
+
+#include <TGUI/Color.hpp>
+#include <TGUI/Font.hpp>
+#include <TGUI/TextStyle.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/String.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Color and style of the characters of a text, stored as runs of characters that look the same
+    ///
+    /// Every character of the text belongs to exactly one run, so the memory usage depends on the amount of style changes
+    /// instead of on the length of the text. Characters with an unset color are drawn in the text color of the widget.
+    ///
+    /// The Bold style is not supported, because widgets measure and wrap their text with the advances of regular characters.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API StyledSpans
+    {
+    public:
+
+        /// @brief Part of the text in which all characters have the same color and style
+        struct Span
+        {
+            std::size_t start = 0;  ///< Index of the first character in the span
+            std::size_t length = 0; ///< Amount of characters in the span
+            Color color;            ///< Color of the characters, unset when the default color has to be used
+            TextStyle style;        ///< Style of the characters, unset when they are regular
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param length  Amount of characters in the text, which initially don't have a color or style
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit StyledSpans(std::size_t length = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of characters covered by the spans
+        ///
+        /// @return Length of the text
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLength() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds characters with the given color and style behind the existing ones
+        ///
+        /// @param length  Amount of characters to add
+        /// @param color   Color of the new characters, or an unset color to use the default color
+        /// @param style   Style of the new characters
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void append(std::size_t length, Color color = {}, TextStyle style = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the color and style of a part of the text
+        ///
+        /// @param start   Index of the first character to change
+        /// @param length  Amount of characters to change
+        /// @param color   New color of the characters, or an unset color to use the default color
+        /// @param style   New style of the characters
+        ///
+        /// Characters behind the end of the text are ignored.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setStyle(std::size_t start, std::size_t length, Color color, TextStyle style = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Inserts characters without a color or style
+        ///
+        /// @param position  Index at which the characters are inserted
+        /// @param count     Amount of inserted characters
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(std::size_t position, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes characters
+        ///
+        /// @param position  Index of the first character to remove
+        /// @param count     Amount of characters to remove
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void erase(std::size_t position, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all characters
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of runs in which the text is divided
+        ///
+        /// @return Number of spans, neighboring spans never have the same color and style
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getSpanCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the span containing a character
+        ///
+        /// @param position  Index of the character
+        ///
+        /// @return Span to which the character belongs, or an empty span when the position lies behind the text
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Span getSpan(std::size_t position) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the spans of a part of the text
+        ///
+        /// @param start   Index of the first character
+        /// @param length  Amount of characters
+        ///
+        /// @return Spans that overlap with the part of the text, cut off at its borders
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<Span> getSpans(std::size_t start, std::size_t length) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Generates the vertices of a single line of a text, with the color and style of every span
+        ///
+        /// @param vertices       Vertex array to which the glyphs are added
+        /// @param font           Font of the text
+        /// @param characterSize  Character size of the text
+        /// @param string         String containing the text
+        /// @param start          Index of the first character of the line in the string
+        /// @param length         Amount of characters in the line, which should not contain a newline
+        /// @param position       Position of the top-left corner of the line
+        /// @param defaultColor   Color of the characters without a color, and of the characters behind the spans
+        /// @param opacity        Opacity with which all colors are multiplied
+        /// @param ignoreColors   Should all characters be drawn in the default color (e.g. because they are selected)?
+        ///
+        /// @return Horizontal position behind the last character
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float appendGlyphs(std::vector<sf::Vertex>& vertices, const Font& font, unsigned int characterSize, const sf::String& string,
+                           std::size_t start, std::size_t length, sf::Vector2f position, const sf::Color& defaultColor, float opacity,
+                           bool ignoreColors = false) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that a run starts at the given position and returns its index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t splitAt(std::size_t position);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Merges the run at the given index with the run in front of it when they look the same
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mergeWithPrevious(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Run
+        {
+            std::size_t start;
+            Color color;
+            TextStyle style;
+        };
+
+        std::vector<Run> m_runs; // Sorted on their start position, a run ends where the next one begins
+        std::size_t m_length = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_STYLED_SPANS_HPP
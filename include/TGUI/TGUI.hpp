@@ -30,6 +30,7 @@
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/Animation.hpp>
 #include <TGUI/Widget.hpp>
+#include <TGUI/WidgetPrototype.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Gui.hpp>
@@ -37,6 +38,8 @@
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Loading/BinaryThemeLoader.hpp>
+#include <TGUI/Loading/ResourcePack.hpp>
 #include <TGUI/Loading/WidgetLoader.hpp>
 #include <TGUI/Loading/WidgetSaver.hpp>
 
@@ -31,6 +31,9 @@
 #include <TGUI/TextStyle.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <memory>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -61,6 +64,41 @@ namespace tgui
         static float calculateExtraVerticalSpace(Font font, unsigned int characterSize, TextStyle style = sf::Text::Regular);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width of a single line of text
+        ///
+        /// @param text          The text to measure, newline characters should not be part of it
+        /// @param font          Font of the text
+        /// @param characterSize The text size
+        /// @param style         Style of the text
+        ///
+        /// @return Width of the text, this is the position where a character placed behind the text would be drawn
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static float getLineWidth(const sf::String& text, Font font, unsigned int characterSize, TextStyle style = sf::Text::Regular);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the positions where lines have to be broken so that the width of the text does not exceed maxWidth
+        ///
+        /// @param maxWidth         Maximum width of the text
+        /// @param text             The text to wrap
+        /// @param font             Font of the text
+        /// @param textSize         The text size
+        /// @param bold             Is the text drawn in bold?
+        /// @param dropLeadingSpace Should a single space at the beginning of a line be moved to the end of the previous line?
+        ///
+        /// @return Positions in the text at which a new line starts, in increasing order. A newline character in the text
+        ///         remains at the end of its line, so line i consists of the characters between the start positions of line i
+        ///         and line i+1 (with 0 being the start of the first line and the text size being the end of the last line).
+        ///
+        /// The text is processed in a single pass and no new strings are created, which makes this function a lot faster
+        /// than wordWrap when the caller needs the lines separately anyway.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::vector<std::size_t> findLineBreaks(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace = true);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// Takes a string and inserts newlines into it so that the width does not exceed maxWidth.
         ///
@@ -74,6 +112,24 @@ namespace tgui
         static sf::String wordWrap(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace = true);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws glyph vertices with the texture of a font
+        ///
+        /// @param target         Render target to draw to
+        /// @param states         Current render states
+        /// @param vertices       Vertices created with GlyphRunCache::appendGlyphs
+        /// @param vertexCount    Amount of vertices
+        /// @param font           Font that was used to create the vertices
+        /// @param characterSize  Character size that was used to create the vertices
+        ///
+        /// The position is rounded to avoid blurry text. When the font uses distance field rendering, the glyphs are drawn
+        /// from its distance field atlas instead of from the font texture.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void drawGlyphs(sf::RenderTarget& target, sf::RenderStates states, const sf::Vertex* vertices, std::size_t vertexCount,
+                               const Font& font, unsigned int characterSize);
+
+
     public:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -231,14 +287,28 @@ namespace tgui
         void recalculateSize();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the color of the vertices, the glyph run has to be looked up again when it differs from the current color.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVertexColor(sf::Color color);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        sf::Text     m_text;
+        sf::String   m_string;
+        unsigned int m_characterSize = 30;
+        TextStyle    m_style;
         sf::Vector2f m_size;
         Font         m_font;
         Color        m_color;
         float        m_opacity = 1;
+
+        // Color with the opacity applied, texts are white until a color is set
+        sf::Color    m_vertexColor = sf::Color::White;
+
+        // Vertices shared with other texts with the same font, size, style, color and string, retrieved when the text is drawn
+        mutable std::shared_ptr<const std::vector<sf::Vertex>> m_glyphRun;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,288 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_TEXT_LAYOUT_HPP
+#define TGUI_TEXT_LAYOUT_HPP
+
+
+#include <TGUI/Font.hpp>
+#include <TGUI/Color.hpp>
+#include <TGUI/TextStyle.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Multi-line text that is word-wrapped, aligned per line and drawn as a single vertex array
+    ///
+    /// Unlike a Label built from one Text object per line, all glyphs of all lines are stored in one vertex array so the whole
+    /// text is rendered with a single draw call. The lines are only split again when the text, font, character size,
+    /// style or maximum width changes, and the vertices are only regenerated when the layout or alignment changes.
+    /// Changing the color or opacity just updates the colors of the existing vertices.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextLayout : public sf::Transformable
+    {
+    public:
+
+        /// @brief The horizontal alignment of the lines
+        enum class Alignment
+        {
+            Left,   ///< Lines start at the left side
+            Center, ///< Lines are centered horizontally
+            Right   ///< Lines end at the right side
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the text
+        ///
+        /// @param string  The new text, which may contain newline characters
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setString(const sf::String& string);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text
+        ///
+        /// @return The text that was passed to setString
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::String& getString() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the font used for the text
+        ///
+        /// @param font  The new font
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFont(Font font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the font used for the text
+        ///
+        /// @return The font
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Font getFont() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the character size of the text
+        ///
+        /// @param size  The new text size
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCharacterSize(unsigned int size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the character size of the text
+        ///
+        /// @return The text size
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getCharacterSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the text style
+        ///
+        /// @param style  New text style
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setStyle(TextStyle style);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text style
+        ///
+        /// @return Style of the text
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextStyle getStyle() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the color of the text
+        ///
+        /// @param color  The new text color
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setColor(Color color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the color of the text
+        ///
+        /// @return Text color
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Color getColor() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the opacity of the text
+        ///
+        /// @param opacity  The opacity of the text. 0 means completely transparent, while 1 (default) means fully opaque
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setOpacity(float opacity);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the opacity of the text
+        ///
+        /// @return The opacity of the text. 0 means completely transparent, while 1 (default) means fully opaque
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getOpacity() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the width at which the text is word-wrapped
+        ///
+        /// @param maxWidth  Maximum width of a line, or 0 to only start a new line at newline characters
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMaximumWidth(float maxWidth);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width at which the text is word-wrapped
+        ///
+        /// @return Maximum width of a line, or 0 when the text is only split at newline characters
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getMaximumWidth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how the lines are aligned horizontally
+        ///
+        /// @param alignment  Horizontal alignment of each line
+        /// @param width      Width of the area in which the lines are aligned, starting at the position of the text
+        ///
+        /// Whitespace at the end of a line is ignored when centering it or aligning it to the right.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAlignment(Alignment alignment, float width);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how the lines are aligned horizontally
+        ///
+        /// @return Horizontal alignment of each line
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Alignment getAlignment() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of lines after word-wrapping the text
+        ///
+        /// @return Number of lines, which is at least 1 when a font is set
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the text
+        ///
+        /// @return Width of the widest line and height of all lines together
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2f getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the text with a single draw call
+        ///
+        /// @param target Render target to draw to
+        /// @param states Current render states
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the text in lines and measures them when the text, font, size, style or maximum width changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLines() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Generates the glyph quads of all lines when the layout or alignment changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVertices() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Line
+        {
+            std::size_t start;  // Index of the first character of the line in the string
+            std::size_t length; // Amount of characters, without the newline character that ends the line
+            float width;        // Width of the entire line
+            float textWidth;    // Width of the line without trailing whitespace, used for the alignment
+        };
+
+        sf::String   m_string;
+        Font         m_font;
+        unsigned int m_characterSize = 30;
+        TextStyle    m_style;
+        Color        m_color;
+        float        m_opacity = 1;
+        float        m_maximumWidth = 0;
+        Alignment    m_alignment = Alignment::Left;
+        float        m_alignmentWidth = 0;
+
+        // The lines and vertices are only calculated when they are needed
+        mutable std::vector<Line> m_lines;
+        mutable sf::Vector2f m_size;
+        mutable std::vector<sf::Vertex> m_vertices;
+        mutable bool m_linesNeedUpdate = true;
+        mutable bool m_verticesNeedUpdate = true;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_LAYOUT_HPP
@@ -79,10 +79,32 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Decodes an image in advance, so that only the texture has to be created when the image is loaded later
+        ///
+        /// @param filename  Filename of the image to decode
+        ///
+        /// This function may be called from any thread. The image is decoded with the image loader of the Texture class and is
+        /// kept until getTexture is called with the same filename, at which point it is uploaded to the graphics card.
+        ///
+        /// @return True when the image was decoded successfully, false otherwise
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool preloadImage(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all images that were preloaded but not yet used by a texture
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearPreloadedImages();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         static std::map<std::string, std::list<TextureDataHolder>> m_imageMap;
+        static std::map<std::string, std::unique_ptr<sf::Image>> m_preloadedImages;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -101,7 +101,7 @@ namespace tgui
         /// @param rendererData  new renderer data
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void setRenderer(const std::shared_ptr<RendererData>& rendererData);
+        void setRenderer(std::shared_ptr<RendererData> rendererData);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -511,6 +511,31 @@ namespace tgui
         virtual void rendererChanged(const std::string& property);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function called when several properties of the renderer were changed together
+        ///
+        /// @param properties  Lowercase names of the properties that were changed
+        ///
+        /// The default implementation calls rendererChanged for each property. Work that was postponed with
+        /// postponeDuringRendererUpdate while doing so is done once afterwards by calling updateAfterRendererChanges.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void rendererPropertiesChanged(const std::set<std::string>& properties);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Postpones expensive work (e.g. rearranging the text) while several renderer properties are being changed together.
+        // Returns true when the caller should skip the work, updateAfterRendererChanges will be called once all are set.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool postponeDuringRendererUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called after several renderer properties were changed together, when work was postponed while they were being set
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void updateAfterRendererChanges();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief This function is called when the mouse enters the widget
         ///
@@ -553,6 +578,12 @@ namespace tgui
         void rendererChangedCallback(const std::string& property);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Callback function which is called when several renderer properties changed and which calls rendererPropertiesChanged
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rendererChangedCallback(const std::set<std::string>& properties);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -606,6 +637,10 @@ namespace tgui
         // Show animations
         std::vector<std::shared_ptr<priv::Animation>> m_showAnimations;
 
+        // While several renderer properties are changed at once, expensive work can be postponed until they are all set
+        bool m_rendererUpdateInProgress = false;
+        bool m_rendererUpdatePostponed = false;
+
         // Cached renderer properties
         Font  m_fontCached;
         float m_opacityCached;
@@ -614,6 +649,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container; // Container changes widget properties of its child widgets
+        friend class WidgetPrototype; // WidgetPrototype copies widgets and shares their renderers
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,134 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_WIDGET_PROTOTYPE_HPP
+#define TGUI_WIDGET_PROTOTYPE_HPP
+
+#include <TGUI/Widget.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Template from which many identical widgets (or groups of widgets) can be created cheaply
+    ///
+    /// The prototype stores its own copy of the widget that it was constructed from. The renderers of that copy and of all
+    /// the widgets inside it are made copy-on-write, so every instance shares the renderer data with the prototype until
+    /// the instance changes one of its renderer properties. Unlike copying a widget with its copy function, changing the
+    /// renderer of one instance thus never affects the other instances.
+    ///
+    /// Only the renderers are shared. Everything else, like the texts, the strings of list items and the signal tables,
+    /// is copied for every instance in the same way as when the widget is copied. The glyphs of identical texts are however
+    /// only laid out once, as they are looked up in the GlyphRunCache.
+    ///
+    /// @code
+    /// auto row = tgui::Panel::create();
+    /// row->loadWidgetsFromFile("InventoryRow.txt");
+    /// tgui::WidgetPrototype rowPrototype{row};
+    ///
+    /// for (unsigned int i = 0; i < 100; ++i)
+    ///     listPanel->add(rowPrototype.instantiate<tgui::Panel>());
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API WidgetPrototype
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor, which creates an empty prototype
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WidgetPrototype() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a prototype from a widget
+        ///
+        /// @param widget  The widget to copy. Later changes to this widget have no influence on the prototype.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WidgetPrototype(const Widget::ConstPtr& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new widget from the prototype
+        ///
+        /// @return The new widget, or nullptr when the prototype is empty
+        ///
+        /// The new widget is a copy of the prototype widget of which only the renderer data is shared.
+        /// The signal handlers are not copied to the new widget, just like when copying a widget.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr instantiate() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new widget from the prototype
+        ///
+        /// @return The new widget, or nullptr when the prototype is empty
+        ///
+        /// @warning The prototype must have been created from a widget of type T
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T>
+        typename T::Ptr instantiate() const
+        {
+            return std::static_pointer_cast<T>(instantiate());
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the widget that is stored inside the prototype
+        ///
+        /// @return Widget from which the instances are created, or nullptr when the prototype is empty
+        ///
+        /// The widget can't be changed, as the instances are sharing their renderers with it.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::ConstPtr getWidget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes the renderer of the widget and of all its child widgets copy-on-write
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void shareRenderers(Widget& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        Widget::Ptr m_widget;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_WIDGET_PROTOTYPE_HPP
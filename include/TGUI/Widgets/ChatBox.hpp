@@ -30,6 +30,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ChatBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/StyledSpans.hpp>
 #include <deque>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,8 +51,17 @@ namespace tgui
 
         struct Line
         {
-            Text text;
             sf::String string;
+            StyledSpans styles;
+            sf::Color color;
+            unsigned int textSize = 0;
+            Font font;
+            std::vector<std::size_t> lineBreaks; // Positions in the string where the word-wrapped text continues on the next row
+            float height = 0;
+
+            // The vertices are only created while the line is visible
+            mutable std::vector<sf::Vertex> vertices;
+            mutable bool verticesValid = false;
         };
 
 
@@ -177,6 +187,40 @@ namespace tgui
         void addLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const Font& font = nullptr);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a new line of text of which parts have their own color and style
+        ///
+        /// The whole text passed to this function will be considered as one line for the getLine and removeLine functions,
+        /// even if it is too long and gets split over multiple lines.
+        ///
+        /// The default text color and character size will be used for the characters that don't have a color in the styles.
+        ///
+        /// @param text    Text that will be added to the chat box
+        /// @param styles  Colors and styles of the characters in the text (the Bold style is not supported)
+        ///
+        /// The colors are stored as runs of characters and the line is drawn with a single vertex array, so a line with a
+        /// colored severity in front of a message doesn't have to be split into several lines.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLine(const sf::String& text, const StyledSpans& styles);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a new line of text of which parts have their own color and style
+        ///
+        /// The whole text passed to this function will be considered as one line for the getLine and removeLine functions,
+        /// even if it is too long and gets split over multiple lines.
+        ///
+        /// @param text      Text that will be added to the chat box
+        /// @param styles    Colors and styles of the characters in the text (the Bold style is not supported)
+        /// @param color     Color of the characters that don't have a color in the styles
+        /// @param textSize  Size of the text
+        /// @param font      Font of the text (nullptr to use default font)
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLine(const sf::String& text, const StyledSpans& styles, const sf::Color& color, unsigned int textSize, const Font& font = nullptr);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the contents of the requested line
         ///
@@ -224,6 +268,17 @@ namespace tgui
         std::shared_ptr<sf::Font> getLineFont(std::size_t lineIndex) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the colors and styles of the characters in the requested line
+        ///
+        /// @param lineIndex  The index of the line of which you request the styles. The first line has index 0
+        ///
+        /// @return The styles of the requested line. Styles without any characters when the index is too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        StyledSpans getLineStyles(std::size_t lineIndex) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes the requested line
         ///
@@ -402,11 +457,17 @@ namespace tgui
     private:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates the text attribute of the line
+        // Recalculates where the line is word-wrapped and how much space it takes
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateLineText(Line& line);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the vertices of a line, with its rows below each other
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLineVertices(const Line& line) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates all text attributes, recalculate the full text height and update the displayed text
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -419,6 +480,12 @@ namespace tgui
         void recalculateFullTextHeight();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbar after the space used by the lines was changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateScrollbarMaximum();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the position of the lines
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -485,6 +552,14 @@ namespace tgui
 
         std::deque<Line> m_lines;
 
+        // The lines that had vertices the last time the chat box was drawn (the last line is not included), and the position
+        // of the first of these lines. They are shifted when lines are inserted or removed before them, and only searched again
+        // from the top when the height of the lines changed.
+        mutable std::size_t m_firstVertexLine = 0;
+        mutable std::size_t m_lastVertexLine = 0;
+        mutable float m_firstVertexLineTop = 0;
+        mutable bool m_vertexLinesOutdated = false;
+
         Sprite m_spriteBackground;
 
         // Cached renderer properties
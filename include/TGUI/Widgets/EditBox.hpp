@@ -29,8 +29,8 @@
 #include <TGUI/Widgets/ClickableWidget.hpp>
 #include <TGUI/Renderers/EditBoxRenderer.hpp>
 #include <TGUI/FloatRect.hpp>
+#include <TGUI/InputValidator.hpp>
 #include <TGUI/Text.hpp>
-#include <regex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -370,6 +370,9 @@ namespace tgui
         /// When the regex does not match when calling the setText function then the edit box contents will be cleared.
         /// When it does not match when the user types a character in the edit box, then the input character is rejected.
         ///
+        /// The regex is compiled into an InputValidator, so a character that is typed at the end of the text is checked in
+        /// constant time. See the InputValidator class for the supported syntax.
+        ///
         /// Examples:
         /// @code
         /// edit1->setInputValidator(EditBox::Validator::Int);
@@ -478,6 +481,20 @@ namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the state of the input validator after reading the given amount of characters from the text.
+        // The states of the prefixes are cached, so checking a character that is typed at the end of the text is cheap.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InputValidator::State getValidatorState(std::size_t length);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Forgets the cached validator states of the prefixes that are longer than the given length.
+        // This function has to be called whenever the text is changed at the given position.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateValidatorStates(std::size_t length);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the position of the texts.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -523,7 +540,10 @@ namespace tgui
         sf::String    m_text;
 
         std::string   m_regexString = ".*";
-        std::regex    m_regex = std::regex{m_regexString};
+        InputValidator m_inputValidator;
+
+        // The validator states after reading the first characters of m_text, element i is the state after i characters
+        std::vector<InputValidator::State> m_validatorStates;
 
         // This will store the size of the text ( 0 to auto size )
         unsigned int  m_textSize = 0;
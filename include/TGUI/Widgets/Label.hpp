@@ -30,6 +30,7 @@
 #include <TGUI/Widgets/ClickableWidget.hpp>
 #include <TGUI/Renderers/LabelRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/TextLayout.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -305,6 +306,12 @@ namespace tgui
         virtual void rendererChanged(const std::string& property) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rearranges the text once after several renderer properties were changed together
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void updateAfterRendererChanges() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called every frame with the time passed since the last frame.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -336,7 +343,7 @@ namespace tgui
     protected:
 
         sf::String m_string;
-        std::vector<Text> m_lines;
+        TextLayout m_textLayout;
 
         unsigned int m_textSize = 18;
         HorizontalAlignment m_horizontalAlignment = HorizontalAlignment::Left;
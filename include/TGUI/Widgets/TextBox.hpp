@@ -30,6 +30,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/TextBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/StyledSpans.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -118,6 +119,43 @@ namespace tgui
         void addText(const sf::String& text);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Appends some text with its own color and style to the text that was already in the text box
+        ///
+        /// @param text   Text that will be added to the text that is already in the text box
+        /// @param color  Color of the added text, or an unset color to use the text color from the renderer
+        /// @param style  Style of the added text (the Bold style is not supported)
+        ///
+        /// The colors and styles are stored as runs of characters, so a long log in which every line starts with a colored
+        /// severity only needs a few bytes per colored part. They stay attached to the characters when the text is edited.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addText(const sf::String& text, Color color, TextStyle style = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the color and style of a part of the text
+        ///
+        /// @param start   Index of the first character to change
+        /// @param length  Amount of characters to change
+        /// @param color   New color of the characters, or an unset color to use the text color from the renderer
+        /// @param style   New style of the characters (the Bold style is not supported)
+        ///
+        /// Changing the text with setText removes all colors and styles.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpanStyle(std::size_t start, std::size_t length, Color color, TextStyle style = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the colors and styles of the characters in the text
+        ///
+        /// @return Runs of characters with the same color and style
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const StyledSpans& getStyledSpans() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the text of the text box
         ///
@@ -357,9 +395,74 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function will split the text into five pieces so that the text can be easily drawn.
+        // Rearrange the text after removedCount characters at the given position were replaced by insertedCount characters.
+        // Only the paragraphs that contain the changed characters are wrapped again, the lines of the other paragraphs are kept.
+        // The styled spans are updated as well, the inserted characters don't have a color or style.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rearrangeChangedText(std::size_t pos, std::size_t removedCount, std::size_t insertedCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Word wraps the paragraph starting at the given position in the text and adds the resulting lines to the vector.
+        // Returns the amount of lines that were added.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t wrapParagraph(std::size_t start, std::size_t length, float maxLineWidth, std::vector<sf::String>& lines) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts a position in the text into a two dimensional position (character index and line number).
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateSelectionTexts();
+        sf::Vector2<std::size_t> findLinePosition(std::size_t textPosition) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the tree with the lengths of the lines, after lines were added or removed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildLineLengthTree();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the length of a line in the tree with the line lengths.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLineLengthInTree(std::size_t line, std::size_t length);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the position in the text where the given line starts.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineStartInTree(std::size_t line) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the last line that starts at or before the given position in the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findLineInTree(std::size_t textPosition) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called when the text or selection changed. It will scroll to the caret and update the vertices.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSelection();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds out which lines are visible and updates their vertices and the selection.
+        // Lines that are not visible don't have vertices, so the memory usage doesn't grow with the length of the document.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleLines();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the vertices of the visible lines. Every line becomes a single vertex array in which the selected characters
+        // have the selected text color and the other characters have the color of their span.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLineVertices();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the part of the selection that lies within the visible lines, the start of the selection is returned first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::pair<sf::Vector2<std::size_t>, sf::Vector2<std::size_t>> getVisibleSelection() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -381,6 +484,12 @@ namespace tgui
         sf::Vector2f getInnerSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width that is available for a single line of text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getMaxLineWidth() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called every frame with the time passed since the last frame.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -394,7 +503,7 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates which lines are currently visible.
+        // Recalculates which lines are currently visible. The vertices are updated when different lines became visible.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateVisibleLines();
 
@@ -420,6 +529,12 @@ namespace tgui
         virtual void rendererChanged(const std::string& property) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rearranges the text once after several renderer properties were changed together
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void updateAfterRendererChanges() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -444,6 +559,16 @@ namespace tgui
 
         std::vector<sf::String> m_lines;
 
+        // Which lines end with a newline, this allows rewrapping only the paragraphs that were edited
+        std::vector<bool> m_lineEndsParagraph;
+
+        // Fenwick tree of the line lengths (including the newline at the end of a paragraph). It allows converting a position
+        // in the text to a line and back in logarithmic time.
+        std::vector<std::size_t> m_lineLengthTree;
+
+        // Are the lines out of date because the text could not be wrapped when it was changed?
+        bool m_linesOutdated = true;
+
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
 
@@ -451,6 +576,10 @@ namespace tgui
         std::size_t m_topLine = 1;
         std::size_t m_visibleLines = 1;
 
+        // The lines of which the vertices are currently stored (the last line is not included)
+        std::size_t m_firstVertexLine = 0;
+        std::size_t m_lastVertexLine = 0;
+
         // Information about the selection
         sf::Vector2<std::size_t> m_selStart;
         sf::Vector2<std::size_t> m_selEnd;
@@ -459,11 +588,11 @@ namespace tgui
         sf::Vector2f m_caretPosition;
         bool m_caretVisible = true;
 
-        Text m_textBeforeSelection;
-        Text m_textSelection1;
-        Text m_textSelection2;
-        Text m_textAfterSelection1;
-        Text m_textAfterSelection2;
+        // Color and style of the characters in the text
+        StyledSpans m_styledSpans;
+
+        // Vertices of the glyphs of the visible lines (from m_firstVertexLine until m_lastVertexLine)
+        std::vector<std::vector<sf::Vertex>> m_lineVertices;
 
         std::vector<sf::FloatRect> m_selectionRects;
 
@@ -484,6 +613,8 @@ namespace tgui
         Color   m_backgroundColorCached;
         Color   m_caretColorCached;
         Color   m_selectedTextBackgroundColorCached;
+        Color   m_textColorCached;
+        Color   m_selectedTextColorCached;
         float   m_caretWidthCached = 0;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
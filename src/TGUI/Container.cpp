@@ -28,10 +28,20 @@
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetSaver.hpp>
 #include <TGUI/Loading/WidgetLoader.hpp>
+#include <TGUI/Loading/ResourcePack.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cstdio>
 #include <fstream>
 
+#ifdef SFML_SYSTEM_WINDOWS
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -52,8 +62,14 @@ namespace tgui
         Widget{other}
     {
         // Copy all the widgets
+        m_widgets.reserve(other.m_widgets.size());
+        m_widgetNames.reserve(other.m_widgetNames.size());
         for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
             add(other.m_widgets[i]->clone(), other.m_widgetNames[i]);
+
+        // Widgets that weren't loaded yet will be loaded separately by the copy
+        if (other.m_lazyLoadFunction)
+            setLazyChildren(other.m_lazyLoadFunction, other.m_lazyWidgetNames);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -64,8 +80,12 @@ namespace tgui
         m_widgetNames         {std::move(other.m_widgetNames)},
         m_widgetBelowMouse    {std::move(other.m_widgetBelowMouse)},
         m_focusedWidget       {std::move(other.m_focusedWidget)},
-        m_handingMouseReleased{std::move(other.m_handingMouseReleased)}
+        m_handingMouseReleased{std::move(other.m_handingMouseReleased)},
+        m_lazyLoadFunction    {std::move(other.m_lazyLoadFunction)},
+        m_lazyWidgetNames     {std::move(other.m_lazyWidgetNames)}
     {
+        other.m_lazyLoadFunction = nullptr;
+
         for (auto& widget : m_widgets)
             widget->setParent(this);
 
@@ -104,6 +124,9 @@ namespace tgui
                 // Don't allow the 'add' function of a derived class to be called, since its members are not copied yet
                 Container::add(right.m_widgets[i]->clone(), right.m_widgetNames[i]);
             }
+
+            if (right.m_lazyLoadFunction)
+                setLazyChildren(right.m_lazyLoadFunction, right.m_lazyWidgetNames);
         }
 
         return *this;
@@ -116,6 +139,23 @@ namespace tgui
         // Make sure it is not the same widget
         if (this != &right)
         {
+            loadLazyChildren();
+            right.loadLazyChildren();
+
+            GuiContainer* root = getRootGuiContainer();
+            if (root)
+            {
+                for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                    updateNameIndex(*root, m_widgets[i], m_widgetNames[i], false);
+            }
+
+            GuiContainer* rightRoot = right.getRootGuiContainer();
+            if (rightRoot)
+            {
+                for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
+                    updateNameIndex(*rightRoot, right.m_widgets[i], right.m_widgetNames[i], false);
+            }
+
             Widget::operator=(std::move(right));
             m_widgets              = std::move(right.m_widgets);
             m_widgetNames          = std::move(right.m_widgetNames);
@@ -127,6 +167,13 @@ namespace tgui
                 widget->setParent(this);
 
             right.m_widgets = {};
+
+            root = getRootGuiContainer();
+            if (root)
+            {
+                for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                    updateNameIndex(*root, m_widgets[i], m_widgetNames[i], true);
+            }
         }
 
         return *this;
@@ -149,14 +196,21 @@ namespace tgui
     {
         assert(widgetPtr != nullptr);
 
+        // The delayed widgets have to be loaded first, they were added to the container before this widget
+        loadLazyChildren();
+
         // Let the widget inherit our font if it did not had a font yet
         if (!widgetPtr->getRenderer()->getFont() && m_fontCached)
-            widgetPtr->getRenderer()->setFont(m_fontCached);
+            widgetPtr->getRenderer()->inheritFont(m_fontCached);
 
         widgetPtr->setParent(this);
         m_widgets.push_back(widgetPtr);
         m_widgetNames.push_back(widgetName);
 
+        GuiContainer* root = getRootGuiContainer();
+        if (root)
+            updateNameIndex(*root, widgetPtr, widgetName, true);
+
         if (m_opacityCached < 1)
             widgetPtr->getRenderer()->setOpacity(m_opacityCached);
     }
@@ -165,6 +219,46 @@ namespace tgui
 
     Widget::Ptr Container::get(const sf::String& widgetName) const
     {
+        // Child widgets that haven't been loaded yet are loaded when one of them is requested
+        if (m_lazyLoadFunction && (std::find(m_lazyWidgetNames.begin(), m_lazyWidgetNames.end(), widgetName) != m_lazyWidgetNames.end()))
+            loadLazyChildren();
+
+        // Inside a gui, the widget can be looked up in the name index. Only when several widgets inside this container share
+        // the name do we have to search through the widgets to find out which of them comes first.
+        GuiContainer* root = getRootGuiContainer();
+        if (root && !widgetName.isEmpty())
+        {
+            loadLazyWidgets(*root, widgetName);
+
+            Widget::Ptr foundWidget;
+            bool ambiguous = false;
+            const auto range = root->m_widgetNameIndex.equal_range(widgetName);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                Widget::Ptr widget = it->second.lock();
+                if (!widget)
+                    continue;
+
+                const Container* parent = widget->m_parent;
+                while (parent && (parent != this))
+                    parent = parent->m_parent;
+
+                if (!parent)
+                    continue;
+
+                if (foundWidget)
+                {
+                    ambiguous = true;
+                    break;
+                }
+
+                foundWidget = widget;
+            }
+
+            if (!ambiguous)
+                return foundWidget;
+        }
+
         for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
         {
             if (m_widgetNames[i] == widgetName)
@@ -208,6 +302,10 @@ namespace tgui
                 else if (m_focusedWidget > i+1)
                     m_focusedWidget--;
 
+                GuiContainer* root = getRootGuiContainer();
+                if (root)
+                    updateNameIndex(*root, widget, m_widgetNames[i], false);
+
                 // Remove the widget
                 widget->setParent(nullptr);
                 m_widgets.erase(m_widgets.begin() + i);
@@ -223,6 +321,19 @@ namespace tgui
 
     void Container::removeAllWidgets()
     {
+        GuiContainer* root = getRootGuiContainer();
+        if (root)
+        {
+            for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                updateNameIndex(*root, m_widgets[i], m_widgetNames[i], false);
+
+            updateLazyNameIndex(*root, *this, false);
+        }
+
+        // Widgets that weren't loaded yet are no longer needed
+        m_lazyLoadFunction = nullptr;
+        m_lazyWidgetNames.clear();
+
         for (const auto& widget : m_widgets)
             widget->setParent(nullptr);
 
@@ -242,6 +353,13 @@ namespace tgui
         {
             if (m_widgets[i] == widget)
             {
+                GuiContainer* root = getRootGuiContainer();
+                if (root)
+                {
+                    updateNameIndexEntry(*root, widget, m_widgetNames[i], false);
+                    updateNameIndexEntry(*root, widget, name, true);
+                }
+
                 m_widgetNames[i] = name;
                 return true;
             }
@@ -438,27 +556,87 @@ namespace tgui
 
     void Container::loadWidgetsFromFile(const std::string& filename)
     {
-        std::ifstream in{filename};
+        // Parse the file straight from a mounted resource pack when it is part of one
+        const char* packedData;
+        std::size_t packedSize;
+        if (const auto pack = ResourcePack::findMountedFile(filename, packedData, packedSize))
+        {
+            WidgetLoader::load(std::static_pointer_cast<Container>(shared_from_this()), packedData, packedSize);
+            return;
+        }
+
+        std::ifstream in{filename, std::ios::binary};
         if (!in.is_open())
             throw Exception{"Failed to open '" + filename + "' to load the widgets from it."};
 
-        std::stringstream stream;
-        stream << in.rdbuf();
-        WidgetLoader::load(std::static_pointer_cast<Container>(shared_from_this()), stream);
+        // Text files are reopened in text mode so that line endings get converted
+        char header[4];
+        if (!in.read(header, sizeof(header)) || !DataIO::isBinary(header, sizeof(header)))
+        {
+            in.close();
+            in.open(filename);
+            if (!in.is_open())
+                throw Exception{"Failed to open '" + filename + "' to load the widgets from it."};
+        }
+
+        // Read the entire file at once and parse it directly from that buffer
+        in.seekg(0, std::ios::end);
+        const auto fileSize = in.tellg();
+        in.seekg(0, std::ios::beg);
+
+        std::string contents;
+        if (fileSize > 0)
+        {
+            contents.resize(static_cast<std::size_t>(fileSize));
+            in.read(&contents[0], fileSize);
+            contents.resize(static_cast<std::size_t>(in.gcount()));
+        }
+
+        WidgetLoader::load(std::static_pointer_cast<Container>(shared_from_this()), contents.data(), contents.size());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::saveWidgetsToFile(const std::string& filename)
+    void Container::saveWidgetsToFile(const std::string& filename, bool binary)
     {
-        std::stringstream stream;
-        WidgetSaver::save(std::static_pointer_cast<Container>(shared_from_this()), stream);
-
-        std::ofstream out{filename};
+        // The widgets are written to a temporary file first, so that the existing file is kept when saving fails halfway
+        const std::string temporaryFilename = filename + ".tmp";
+        std::ofstream out{temporaryFilename, binary ? (std::ios::out | std::ios::binary) : std::ios::out};
         if (!out.is_open())
-            throw Exception{"Failed to open '" + filename + "' for saving the widgets to it."};
+            throw Exception{"Failed to open '" + temporaryFilename + "' for saving the widgets to it."};
+
+        // The widgets are written directly to the file, without first creating the entire file in memory
+        try
+        {
+            if (binary)
+                WidgetSaver::saveBinary(std::static_pointer_cast<Container>(shared_from_this()), out);
+            else
+                WidgetSaver::save(std::static_pointer_cast<Container>(shared_from_this()), out);
+
+            out.flush();
+            if (!out)
+                throw Exception{"Failed to write the widgets to '" + temporaryFilename + "'."};
+
+            out.close();
+            if (out.fail())
+                throw Exception{"Failed to close '" + temporaryFilename + "' after writing the widgets to it."};
+        }
+        catch (...)
+        {
+            out.close();
+            std::remove(temporaryFilename.c_str());
+            throw;
+        }
 
-        out << stream.rdbuf();
+        // Replace the original file in a single step, so that it is never lost. When this fails then the original file is left
+        // untouched and the saved widgets are kept in the temporary file.
+    #ifdef SFML_SYSTEM_WINDOWS
+        const bool replaced = (MoveFileExA(temporaryFilename.c_str(), filename.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0);
+    #else
+        const bool replaced = (std::rename(temporaryFilename.c_str(), filename.c_str()) == 0);
+    #endif
+        if (!replaced)
+            throw Exception{"Failed to replace '" + filename + "' by the saved widgets, they were saved in '" + temporaryFilename + "' instead."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -544,6 +722,48 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::show()
+    {
+        loadLazyChildren();
+        Widget::show();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setLazyChildren(const std::function<void(Container&)>& loadFunction, std::vector<sf::String> widgetNames)
+    {
+        loadLazyChildren();
+
+        m_lazyLoadFunction = loadFunction;
+        m_lazyWidgetNames = std::move(widgetNames);
+
+        GuiContainer* root = getRootGuiContainer();
+        if (root)
+            updateLazyNameIndex(*root, *this, true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadLazyChildren() const
+    {
+        if (!m_lazyLoadFunction)
+            return;
+
+        GuiContainer* root = getRootGuiContainer();
+        if (root)
+            updateLazyNameIndex(*root, *this, false);
+
+        const auto loadFunction = std::move(m_lazyLoadFunction);
+        m_lazyLoadFunction = nullptr;
+        m_lazyWidgetNames.clear();
+
+        // Loading the widgets doesn't change what the container looks like from the outside, which is why the const member
+        // functions may load them. Containers are always created through a non-const shared pointer, so the cast is safe.
+        loadFunction(const_cast<Container&>(*this));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::leftMousePressed(sf::Vector2f pos)
     {
         sf::Event event;
@@ -695,7 +915,7 @@ namespace tgui
             if (m_fontCached != nullptr)
             {
                 for (const auto& widget : m_widgets)
-                    widget->getRenderer()->setFont(m_fontCached);
+                    widget->getRenderer()->inheritFont(m_fontCached);
             }
         }
     }
@@ -1063,6 +1283,126 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    GuiContainer* Container::getRootGuiContainer() const
+    {
+        const Container* container = this;
+        while (container->m_parent)
+            container = container->m_parent;
+
+        return dynamic_cast<GuiContainer*>(const_cast<Container*>(container));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateNameIndex(GuiContainer& root, const Widget::Ptr& widget, const sf::String& widgetName, bool added)
+    {
+        updateNameIndexEntry(root, widget, widgetName, added);
+
+        if (widget->m_containerWidget)
+        {
+            const auto& container = static_cast<const Container&>(*widget);
+            updateLazyNameIndex(root, container, added);
+            for (std::size_t i = 0; i < container.m_widgets.size(); ++i)
+                updateNameIndex(root, container.m_widgets[i], container.m_widgetNames[i], added);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateNameIndexEntry(GuiContainer& root, const Widget::Ptr& widget, const sf::String& widgetName, bool added)
+    {
+        // Unnamed widgets are not stored in the index
+        if (widgetName.isEmpty())
+            return;
+
+        if (added)
+        {
+            root.m_widgetNameIndex.emplace(widgetName, widget);
+            return;
+        }
+
+        const auto range = root.m_widgetNameIndex.equal_range(widgetName);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second.lock() == widget)
+            {
+                root.m_widgetNameIndex.erase(it);
+                break;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateLazyNameIndex(GuiContainer& root, const Container& container, bool added)
+    {
+        if (!container.m_lazyLoadFunction)
+            return;
+
+        if (added)
+        {
+            const auto containerPtr = std::static_pointer_cast<Container>(std::const_pointer_cast<Widget>(container.shared_from_this()));
+            for (const auto& name : container.m_lazyWidgetNames)
+            {
+                if (!name.isEmpty())
+                    root.m_lazyWidgetNameIndex.emplace(name, containerPtr);
+            }
+
+            return;
+        }
+
+        for (const auto& name : container.m_lazyWidgetNames)
+        {
+            const auto range = root.m_lazyWidgetNameIndex.equal_range(name);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (it->second.lock().get() == &container)
+                {
+                    root.m_lazyWidgetNameIndex.erase(it);
+                    break;
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadLazyWidgets(GuiContainer& root, const sf::String& widgetName) const
+    {
+        // Loading a container can add containers that were delayed themselves, so the index is searched again after each one
+        bool searchAgain = true;
+        while (searchAgain)
+        {
+            searchAgain = false;
+
+            const auto range = root.m_lazyWidgetNameIndex.equal_range(widgetName);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                const auto container = it->second.lock();
+                if (!container || !container->m_lazyLoadFunction)
+                {
+                    // The container no longer exists or was moved
+                    root.m_lazyWidgetNameIndex.erase(it);
+                    searchAgain = true;
+                    break;
+                }
+
+                const Container* parent = container.get();
+                while (parent && (parent != this))
+                    parent = parent->m_parent;
+
+                if (parent)
+                {
+                    container->loadLazyChildren();
+                    searchAgain = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     GuiContainer::GuiContainer()
     {
         m_type = "GuiContainer";
@@ -1088,6 +1428,21 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t GuiContainer::WidgetNameHash::operator()(const sf::String& name) const
+    {
+        // FNV-1a hash of the characters
+        std::size_t hash = 2166136261u;
+        for (const sf::Uint32 character : name)
+        {
+            hash ^= character;
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
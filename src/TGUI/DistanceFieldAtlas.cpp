@@ -0,0 +1,382 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/DistanceFieldAtlas.hpp>
+#include <SFML/OpenGL.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Reconstructs the outline of the glyphs from the distance field, anti-aliased over the width of a screen pixel
+        const char* distanceFieldShaderSource =
+            "uniform sampler2D texture;"
+            "void main()"
+            "{"
+            "    float distance = texture2D(texture, gl_TexCoord[0].xy).a;"
+            "    float smoothing = fwidth(distance);"
+            "    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);"
+            "    gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * alpha);"
+            "}";
+
+        // Size of the opaque block in the top-left corner of the texture, used for underlines and strike through lines
+        const unsigned int solidBlockSize = 4;
+
+        // Size of the texture before it has to grow
+        const unsigned int initialTextureWidth = 512;
+        const unsigned int initialTextureHeight = 64;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DistanceFieldAtlas::DistanceFieldAtlas(std::shared_ptr<sf::Font> font, unsigned int baseCharacterSize, unsigned int spread,
+                                           unsigned int maximumTextureSize) :
+        m_font              {std::move(font)},
+        m_baseCharacterSize {baseCharacterSize},
+        m_spread            {std::max(1u, spread)},
+        m_maximumTextureSize{std::max(solidBlockSize, (maximumTextureSize > 0) ? maximumTextureSize : sf::Texture::getMaximumSize())}
+    {
+        assert(m_font != nullptr);
+
+        const int range = static_cast<int>(m_spread);
+        for (int y = -range; y <= range; ++y)
+        {
+            for (int x = -range; x <= range; ++x)
+            {
+                const float distance = std::sqrt(static_cast<float>(x * x + y * y));
+                if ((distance > 0) && (distance <= m_spread))
+                    m_offsets.push_back({x, y, distance});
+            }
+        }
+
+        std::stable_sort(m_offsets.begin(), m_offsets.end(), [](const Offset& left, const Offset& right){ return left.distance < right.distance; });
+
+        m_image.create(std::min(initialTextureWidth, m_maximumTextureSize), std::min(initialTextureHeight, m_maximumTextureSize),
+                       sf::Color{255, 255, 255, 0});
+
+        sf::Vector2u position;
+        allocateRect(solidBlockSize, solidBlockSize, position);
+        for (unsigned int y = 0; y < solidBlockSize; ++y)
+        {
+            for (unsigned int x = 0; x < solidBlockSize; ++x)
+                m_image.setPixel(position.x + x, position.y + y, sf::Color::White);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const DistanceFieldAtlas::Glyph& DistanceFieldAtlas::getGlyph(sf::Uint32 codePoint, bool bold)
+    {
+        const sf::Uint64 key = (static_cast<sf::Uint64>(codePoint) << 1) | (bold ? 1 : 0);
+        const auto it = m_glyphs.find(key);
+        if (it != m_glyphs.end())
+            return it->second;
+
+        loadGlyphs(sf::String{codePoint}, 0, 1, bold);
+        return m_glyphs[key];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DistanceFieldAtlas::loadGlyphs(const sf::String& string, std::size_t start, std::size_t length, bool bold)
+    {
+        for (std::size_t i = start; i < start + length; ++i)
+        {
+            const sf::Uint64 key = (static_cast<sf::Uint64>(string[i]) << 1) | (bold ? 1 : 0);
+            if (m_glyphs.find(key) != m_glyphs.end())
+                continue;
+
+            addGlyph(m_glyphs[key], m_font->getGlyph(string[i], m_baseCharacterSize, bold));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int DistanceFieldAtlas::getBaseCharacterSize() const
+    {
+        return m_baseCharacterSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int DistanceFieldAtlas::getSpread() const
+    {
+        return m_spread;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float DistanceFieldAtlas::getScale(unsigned int characterSize) const
+    {
+        return static_cast<float>(characterSize) / m_baseCharacterSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2f DistanceFieldAtlas::getSolidTexCoords() const
+    {
+        return {solidBlockSize / 2.f, solidBlockSize / 2.f};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t DistanceFieldAtlas::getGlyphCount() const
+    {
+        return m_glyphs.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Texture& DistanceFieldAtlas::getTexture()
+    {
+        // Downloading the font texture is slow, so it is done once for all glyphs that were added since the last time
+        if (!m_pendingGlyphs.empty())
+        {
+            const sf::Image fontImage = m_font->getTexture(m_baseCharacterSize).copyToImage();
+            for (const auto& pendingGlyph : m_pendingGlyphs)
+                renderDistanceField(pendingGlyph.first, pendingGlyph.second, fontImage);
+
+            m_pendingGlyphs.clear();
+        }
+
+        if (m_textureNeedsUpdate)
+        {
+            if (m_texture.getSize() != m_image.getSize())
+            {
+                m_texture.loadFromImage(m_image);
+                m_texture.setSmooth(true);
+            }
+            else
+                m_texture.update(m_image);
+
+            m_textureNeedsUpdate = false;
+        }
+
+        return m_texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2u DistanceFieldAtlas::getTextureSize() const
+    {
+        return m_image.getSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DistanceFieldAtlas::draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount, sf::RenderStates states)
+    {
+        if (vertexCount == 0)
+            return;
+
+        if (!m_shaderLoaded)
+        {
+            m_shaderLoaded = true;
+            if (sf::Shader::isAvailable() && m_shader.loadFromMemory(distanceFieldShaderSource, sf::Shader::Fragment))
+            {
+            #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+                m_shader.setUniform("texture", sf::Shader::CurrentTexture);
+            #else
+                m_shader.setParameter("texture", sf::Shader::CurrentTexture);
+            #endif
+                m_shaderAvailable = true;
+            }
+        }
+
+        states.texture = &getTexture();
+        if (m_shaderAvailable)
+        {
+            states.shader = &m_shader;
+            target.draw(vertices, vertexCount, sf::Triangles, states);
+        }
+        else
+        {
+            // Without shaders, the pixels outside the outline are discarded by the alpha test.
+            // The texture alpha is multiplied with the vertex color, so the threshold depends on the opacity of the text.
+            // Pushing the states activates the context of the target, popping them restores the state of the alpha test.
+            target.pushGLStates();
+            glEnable(GL_ALPHA_TEST);
+            glAlphaFunc(GL_GREATER, 0.5f * vertices[0].color.a / 255.f);
+            target.draw(vertices, vertexCount, sf::Triangles, states);
+            glDisable(GL_ALPHA_TEST);
+            target.popGLStates();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DistanceFieldAtlas::allocateRect(unsigned int width, unsigned int height, sf::Vector2u& position)
+    {
+        while (true)
+        {
+            // Start a new shelf when the rectangle doesn't fit on the current one
+            if (m_shelfRight + width > m_image.getSize().x)
+            {
+                m_shelfTop += m_shelfHeight;
+                m_shelfHeight = 0;
+                m_shelfRight = m_shelfLeft;
+            }
+
+            const bool fitsHorizontally = (m_shelfRight + width <= m_image.getSize().x);
+            if (fitsHorizontally && (m_shelfTop + height <= m_image.getSize().y))
+                break;
+
+            // Make the image higher when the shelf doesn't fit in it, or start a new column once it can't become any higher
+            if (fitsHorizontally && (m_image.getSize().y < m_maximumTextureSize) && (m_shelfTop + height <= m_maximumTextureSize))
+            {
+                unsigned int newHeight = m_image.getSize().y;
+                while (m_shelfTop + height > newHeight)
+                    newHeight = std::min(newHeight * 2, m_maximumTextureSize);
+
+                resizeImage(m_image.getSize().x, newHeight);
+            }
+            else if (m_image.getSize().x < m_maximumTextureSize)
+            {
+                m_shelfLeft = m_image.getSize().x;
+                m_shelfRight = m_shelfLeft;
+                m_shelfTop = 0;
+                m_shelfHeight = 0;
+                resizeImage(std::min(m_image.getSize().x * 2, m_maximumTextureSize), m_image.getSize().y);
+            }
+            else
+                return false;
+        }
+
+        position = {m_shelfRight, m_shelfTop};
+        m_shelfRight += width;
+        m_shelfHeight = std::max(m_shelfHeight, height);
+        m_textureNeedsUpdate = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DistanceFieldAtlas::resizeImage(unsigned int width, unsigned int height)
+    {
+        const sf::Vector2u oldSize = m_image.getSize();
+        std::vector<sf::Uint8> pixels(width * height * 4);
+        for (std::size_t i = 0; i < pixels.size(); i += 4)
+        {
+            pixels[i] = 255;
+            pixels[i+1] = 255;
+            pixels[i+2] = 255;
+            pixels[i+3] = 0;
+        }
+
+        const sf::Uint8* oldPixels = m_image.getPixelsPtr();
+        for (unsigned int y = 0; y < oldSize.y; ++y)
+            std::copy(oldPixels + (y * oldSize.x * 4), oldPixels + ((y + 1) * oldSize.x * 4), pixels.begin() + (y * width * 4));
+
+        m_image.create(width, height, pixels.data());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DistanceFieldAtlas::addGlyph(Glyph& glyph, const sf::Glyph& fontGlyph)
+    {
+        glyph.advance = fontGlyph.advance;
+
+        const sf::IntRect& rect = fontGlyph.textureRect;
+        if ((rect.width <= 0) || (rect.height <= 0))
+            return;
+
+        // The distance field extends the bitmap of the glyph with the spread on every side
+        const int spread = static_cast<int>(m_spread);
+        const int width = rect.width + 2 * spread;
+        const int height = rect.height + 2 * spread;
+
+        // A transparent pixel is left between the glyphs to avoid bleeding when the texture is sampled with interpolation
+        sf::Vector2u position;
+        if (!allocateRect(static_cast<unsigned int>(width + 1), static_cast<unsigned int>(height + 1), position))
+            return;
+
+        m_pendingGlyphs.emplace_back(position, rect);
+
+        glyph.bounds = {fontGlyph.bounds.left - spread, fontGlyph.bounds.top - spread, static_cast<float>(width), static_cast<float>(height)};
+        glyph.textureRect = {static_cast<float>(position.x), static_cast<float>(position.y), static_cast<float>(width), static_cast<float>(height)};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DistanceFieldAtlas::renderDistanceField(const sf::Vector2u& position, const sf::IntRect& rect, const sf::Image& fontImage)
+    {
+        const int spread = static_cast<int>(m_spread);
+        const int width = rect.width + 2 * spread;
+        const int height = rect.height + 2 * spread;
+
+        // Find out which pixels lie inside the glyph
+        std::vector<bool> coverage(width * height, false);
+        const sf::Uint8* fontPixels = fontImage.getPixelsPtr();
+        const int fontImageWidth = static_cast<int>(fontImage.getSize().x);
+        const int fontImageHeight = static_cast<int>(fontImage.getSize().y);
+        for (int y = 0; y < rect.height; ++y)
+        {
+            for (int x = 0; x < rect.width; ++x)
+            {
+                if ((rect.left + x < fontImageWidth) && (rect.top + y < fontImageHeight))
+                    coverage[(y + spread) * width + x + spread] = (fontPixels[((rect.top + y) * fontImageWidth + rect.left + x) * 4 + 3] >= 128);
+            }
+        }
+
+        const auto isInside = [&](int x, int y){ return (x >= 0) && (y >= 0) && (x < width) && (y < height) && coverage[y * width + x]; };
+
+        // Store the distance to the nearest pixel on the other side of the outline, which lies halfway between the two pixels
+        const float range = m_spread - 0.5f;
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                const bool inside = isInside(x, y);
+
+                float distance = static_cast<float>(m_spread);
+                for (const auto& offset : m_offsets)
+                {
+                    if (isInside(x + offset.x, y + offset.y) != inside)
+                    {
+                        distance = offset.distance;
+                        break;
+                    }
+                }
+
+                const float signedDistance = std::min(distance - 0.5f, range) * (inside ? 1 : -1);
+                const float value = 0.5f + (signedDistance / (2 * range));
+                m_image.setPixel(position.x + x, position.y + y, {255, 255, 255, static_cast<sf::Uint8>(std::round(value * 255))});
+            }
+        }
+
+        m_textureNeedsUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
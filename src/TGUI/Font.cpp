@@ -26,12 +26,44 @@
 #include <TGUI/Font.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 
+#include <array>
 #include <cassert>
+#include <mutex>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    struct Font::GlyphMetrics
+    {
+        // Advances of the characters for a single character size and style
+        struct Advances
+        {
+            Advances()
+            {
+                latin1.fill(-1);
+            }
+
+            std::array<float, 256> latin1; // A negative value means that the advance wasn't requested yet
+            std::unordered_map<sf::Uint32, float> others;
+        };
+
+        // Kerning of the character pairs for a single character size, the key contains both characters
+        using Kernings = std::unordered_map<sf::Uint64, float>;
+
+        std::unordered_map<unsigned int, Advances> advances; // Key is the character size times two, plus one when bold
+        std::unordered_map<unsigned int, Kernings> kernings; // Key is the character size
+
+        // Text is usually measured in a single character size, so the tables that were used last are remembered
+        Advances* lastAdvances = nullptr;
+        unsigned int lastAdvancesKey = 0;
+        Kernings* lastKernings = nullptr;
+        unsigned int lastKerningsSize = 0;
+
+        std::shared_ptr<DistanceFieldAtlas> distanceFieldAtlas; // Only created when distance field rendering is enabled
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(std::nullptr_t)
@@ -41,9 +73,9 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const std::string& id) :
-        m_font{Deserializer::deserialize(ObjectConverter::Type::Font, id).getFont()},
-        m_id  {Deserializer::deserialize(ObjectConverter::Type::String, id).getString()}
+        Font(Deserializer::deserialize(ObjectConverter::Type::Font, id).getFont())
     {
+        m_id = Deserializer::deserialize(ObjectConverter::Type::String, id).getString();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -56,14 +88,16 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const std::shared_ptr<sf::Font>& font) :
-        m_font{font}
+        m_font   {font},
+        m_metrics{getMetrics(font)}
     {
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const sf::Font& font) :
-        m_font{std::make_shared<sf::Font>(font)}
+        m_font   {std::make_shared<sf::Font>(font)},
+        m_metrics{getMetrics(m_font)}
     {
     }
 
@@ -125,12 +159,65 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float Font::getGlyphAdvance(sf::Uint32 codePoint, unsigned int characterSize, bool bold) const
+    {
+        assert(m_font != nullptr);
+
+        const unsigned int key = (characterSize * 2) + (bold ? 1 : 0);
+        if (!m_metrics->lastAdvances || (m_metrics->lastAdvancesKey != key))
+        {
+            m_metrics->lastAdvances = &m_metrics->advances[key];
+            m_metrics->lastAdvancesKey = key;
+        }
+
+        // With a distance field atlas, the advance is scaled from the base character size instead of rasterizing the glyph again
+        const auto requestAdvance = [&]{
+            if (m_metrics->distanceFieldAtlas)
+                return m_metrics->distanceFieldAtlas->getGlyph(codePoint, bold).advance * m_metrics->distanceFieldAtlas->getScale(characterSize);
+            else
+                return m_font->getGlyph(codePoint, characterSize, bold).advance;
+        };
+
+        GlyphMetrics::Advances& advances = *m_metrics->lastAdvances;
+        if (codePoint < advances.latin1.size())
+        {
+            if (advances.latin1[codePoint] < 0)
+                advances.latin1[codePoint] = requestAdvance();
+
+            return advances.latin1[codePoint];
+        }
+
+        const auto it = advances.others.find(codePoint);
+        if (it != advances.others.end())
+            return it->second;
+
+        const float advance = requestAdvance();
+        advances.others[codePoint] = advance;
+        return advance;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float Font::getKerning(sf::Uint32 first, sf::Uint32 second, unsigned int characterSize) const
     {
-        if (m_font)
-            return m_font->getKerning(first, second, characterSize);
-        else
+        if (!m_font || (first == 0) || (second == 0))
             return 0;
+
+        if (!m_metrics->lastKernings || (m_metrics->lastKerningsSize != characterSize))
+        {
+            m_metrics->lastKernings = &m_metrics->kernings[characterSize];
+            m_metrics->lastKerningsSize = characterSize;
+        }
+
+        GlyphMetrics::Kernings& kernings = *m_metrics->lastKernings;
+        const sf::Uint64 key = (static_cast<sf::Uint64>(first) << 32) | second;
+        const auto it = kernings.find(key);
+        if (it != kernings.end())
+            return it->second;
+
+        const float kerning = m_font->getKerning(first, second, characterSize);
+        kernings.emplace(key, kerning);
+        return kerning;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -144,6 +231,75 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::setDistanceFieldRendering(bool enabled)
+    {
+        if (!m_font || (enabled == isDistanceFieldRendering()))
+            return;
+
+        if (enabled)
+            m_metrics->distanceFieldAtlas = std::make_shared<DistanceFieldAtlas>(m_font);
+        else
+            m_metrics->distanceFieldAtlas = nullptr;
+
+        // The cached advances were requested for the other rendering mode
+        m_metrics->advances.clear();
+        m_metrics->lastAdvances = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Font::isDistanceFieldRendering() const
+    {
+        return m_metrics && m_metrics->distanceFieldAtlas;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<DistanceFieldAtlas> Font::getDistanceFieldAtlas() const
+    {
+        if (m_metrics)
+            return m_metrics->distanceFieldAtlas;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<Font::GlyphMetrics> Font::getMetrics(const std::shared_ptr<sf::Font>& font)
+    {
+        if (!font)
+            return nullptr;
+
+        // Fonts that are created again from the same sf::Font (e.g. by the deserializer or a renderer) share the cached
+        // metrics and the distance field atlas, for as long as one of them exists
+        static std::unordered_map<const sf::Font*, std::pair<std::weak_ptr<sf::Font>, std::weak_ptr<GlyphMetrics>>> sharedMetrics;
+        static std::mutex sharedMetricsMutex;
+
+        std::lock_guard<std::mutex> lock(sharedMetricsMutex);
+        auto it = sharedMetrics.find(font.get());
+        if (it != sharedMetrics.end())
+        {
+            auto metrics = it->second.second.lock();
+            if (metrics && (it->second.first.lock() == font))
+                return metrics;
+        }
+
+        // Forget about the fonts that no longer exist, another font could be created at the same address
+        for (it = sharedMetrics.begin(); it != sharedMetrics.end();)
+        {
+            if (it->second.first.expired() || it->second.second.expired())
+                it = sharedMetrics.erase(it);
+            else
+                ++it;
+        }
+
+        auto metrics = std::make_shared<GlyphMetrics>();
+        sharedMetrics[font.get()] = {font, metrics};
+        return metrics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,346 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/GlyphRunCache.hpp>
+
+#include <cmath>
+#include <list>
+#include <unordered_map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        struct Key
+        {
+            const sf::Font* font;
+            unsigned int characterSize;
+            sf::Uint32 style;
+            bool distanceField;
+            sf::Uint32 color;
+            sf::String string;
+
+            bool operator==(const Key& other) const
+            {
+                return (font == other.font) && (characterSize == other.characterSize) && (style == other.style)
+                    && (distanceField == other.distanceField) && (color == other.color) && (string == other.string);
+            }
+        };
+
+        struct KeyHash
+        {
+            std::size_t operator()(const Key& key) const
+            {
+                // FNV-1a over the code points, combined with the other parts of the key
+                std::size_t hash = 2166136261u;
+                for (const auto c : key.string)
+                    hash = (hash ^ c) * 16777619u;
+
+                hash ^= std::hash<const sf::Font*>()(key.font) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+                hash ^= ((key.characterSize << 9) | (key.style << 1) | (key.distanceField ? 1 : 0)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+                hash ^= key.color + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+                return hash;
+            }
+        };
+
+        struct Entry
+        {
+            std::weak_ptr<sf::Font> font; // An entry becomes invalid when the font is destroyed, even if another font reuses its address
+            std::shared_ptr<const GlyphRunCache::GlyphRun> run;
+            std::list<const Key*>::iterator lruPosition;
+            std::size_t memoryUsage;
+        };
+
+        struct Cache
+        {
+            std::unordered_map<Key, Entry, KeyHash> entries;
+            std::list<const Key*> lruList; // Most recently used entry at the front
+            std::size_t memoryLimit = 4 * 1024 * 1024;
+            GlyphRunCache::Statistics statistics;
+        };
+
+        Cache& getCache()
+        {
+            static Cache cache;
+            return cache;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void removeEntry(Cache& cache, std::unordered_map<Key, Entry, KeyHash>::iterator it)
+        {
+            cache.statistics.memoryUsage -= it->second.memoryUsage;
+            cache.statistics.runCount--;
+            cache.lruList.erase(it->second.lruPosition);
+            cache.entries.erase(it);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void removeLeastRecentlyUsedEntries(Cache& cache)
+        {
+            while ((cache.statistics.memoryUsage > cache.memoryLimit) && !cache.lruList.empty())
+            {
+                removeEntry(cache, cache.entries.find(*cache.lruList.back()));
+                cache.statistics.evictions++;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void addGlyphQuad(GlyphRunCache::GlyphRun& vertices, sf::Vector2f position, const sf::Color& color, const sf::Glyph& glyph, float italicShear)
+        {
+            const float padding = 1.0;
+
+            const float left   = glyph.bounds.left - padding;
+            const float top    = glyph.bounds.top - padding;
+            const float right  = glyph.bounds.left + glyph.bounds.width + padding;
+            const float bottom = glyph.bounds.top  + glyph.bounds.height + padding;
+
+            const float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+            const float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+            const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+            const float v2 = static_cast<float>(glyph.textureRect.top  + glyph.textureRect.height) + padding;
+
+            vertices.emplace_back(sf::Vector2f{position.x + left  - italicShear * top,    position.y + top},    color, sf::Vector2f{u1, v1});
+            vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * top,    position.y + top},    color, sf::Vector2f{u2, v1});
+            vertices.emplace_back(sf::Vector2f{position.x + left  - italicShear * bottom, position.y + bottom}, color, sf::Vector2f{u1, v2});
+            vertices.emplace_back(sf::Vector2f{position.x + left  - italicShear * bottom, position.y + bottom}, color, sf::Vector2f{u1, v2});
+            vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * top,    position.y + top},    color, sf::Vector2f{u2, v1});
+            vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * bottom, position.y + bottom}, color, sf::Vector2f{u2, v2});
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds a glyph from a distance field atlas, scaled from the base character size
+        void addGlyphQuad(GlyphRunCache::GlyphRun& vertices, sf::Vector2f position, const sf::Color& color, const DistanceFieldAtlas::Glyph& glyph, float scale, float italicShear)
+        {
+            if ((glyph.textureRect.width == 0) || (glyph.textureRect.height == 0))
+                return;
+
+            const float left   = glyph.bounds.left * scale;
+            const float top    = glyph.bounds.top * scale;
+            const float right  = (glyph.bounds.left + glyph.bounds.width) * scale;
+            const float bottom = (glyph.bounds.top  + glyph.bounds.height) * scale;
+
+            const float u1 = glyph.textureRect.left;
+            const float v1 = glyph.textureRect.top;
+            const float u2 = glyph.textureRect.left + glyph.textureRect.width;
+            const float v2 = glyph.textureRect.top  + glyph.textureRect.height;
+
+            vertices.emplace_back(sf::Vector2f{position.x + left  - italicShear * top,    position.y + top},    color, sf::Vector2f{u1, v1});
+            vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * top,    position.y + top},    color, sf::Vector2f{u2, v1});
+            vertices.emplace_back(sf::Vector2f{position.x + left  - italicShear * bottom, position.y + bottom}, color, sf::Vector2f{u1, v2});
+            vertices.emplace_back(sf::Vector2f{position.x + left  - italicShear * bottom, position.y + bottom}, color, sf::Vector2f{u1, v2});
+            vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * top,    position.y + top},    color, sf::Vector2f{u2, v1});
+            vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * bottom, position.y + bottom}, color, sf::Vector2f{u2, v2});
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds an underline or strike through line
+        void addLine(GlyphRunCache::GlyphRun& vertices, float left, float lineLength, float lineTop, const sf::Color& color, float offset, float thickness, sf::Vector2f texCoords)
+        {
+            const float top = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
+            const float bottom = top + std::floor(thickness + 0.5f);
+
+            vertices.emplace_back(sf::Vector2f{left, top}, color, texCoords);
+            vertices.emplace_back(sf::Vector2f{left + lineLength, top}, color, texCoords);
+            vertices.emplace_back(sf::Vector2f{left, bottom}, color, texCoords);
+            vertices.emplace_back(sf::Vector2f{left, bottom}, color, texCoords);
+            vertices.emplace_back(sf::Vector2f{left + lineLength, top}, color, texCoords);
+            vertices.emplace_back(sf::Vector2f{left + lineLength, bottom}, color, texCoords);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<const GlyphRunCache::GlyphRun> GlyphRunCache::getGlyphRun(const Font& font, unsigned int characterSize, TextStyle style, const sf::String& string,
+                                                                         sf::Color color)
+    {
+        if (font == nullptr)
+            return std::make_shared<GlyphRun>();
+
+        Cache& cache = getCache();
+        const std::shared_ptr<sf::Font> sfFont = font.getFont();
+
+        Key key{sfFont.get(), characterSize, style, font.isDistanceFieldRendering(), color.toInteger(), string};
+        auto it = cache.entries.find(key);
+        if (it != cache.entries.end())
+        {
+            if (!it->second.font.expired())
+            {
+                cache.statistics.hits++;
+                cache.lruList.splice(cache.lruList.begin(), cache.lruList, it->second.lruPosition);
+                return it->second.run;
+            }
+
+            // The font that was used for the run no longer exists
+            removeEntry(cache, it);
+        }
+
+        cache.statistics.misses++;
+
+        auto run = std::make_shared<GlyphRun>();
+        run->reserve(6 * string.getSize());
+        appendGlyphs(*run, font, characterSize, style, string, 0, string.getSize(), {0, 0}, color);
+        run->shrink_to_fit();
+
+        Entry entry;
+        entry.font = sfFont;
+        entry.run = run;
+        entry.memoryUsage = sizeof(Key) + sizeof(Entry) + (string.getSize() * sizeof(sf::Uint32)) + (run->capacity() * sizeof(sf::Vertex));
+
+        it = cache.entries.emplace(std::move(key), std::move(entry)).first;
+        cache.lruList.push_front(&it->first);
+        it->second.lruPosition = cache.lruList.begin();
+        cache.statistics.memoryUsage += it->second.memoryUsage;
+        cache.statistics.runCount++;
+
+        removeLeastRecentlyUsedEntries(cache);
+        return run;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float GlyphRunCache::appendGlyphs(GlyphRun& vertices, const Font& font, unsigned int characterSize, TextStyle style, const sf::String& string,
+                                      std::size_t start, std::size_t length, sf::Vector2f position, sf::Color color)
+    {
+        if (font == nullptr)
+            return position.x;
+
+        const bool bold = (style & sf::Text::Bold) != 0;
+        const bool underlined = (style & sf::Text::Underlined) != 0;
+        const bool strikeThrough = (style & sf::Text::StrikeThrough) != 0;
+        const float italicShear = (style & sf::Text::Italic) ? 0.209f : 0.f; // 12 degrees
+
+        // Glyphs are taken from the distance field atlas when the font has one, to avoid rasterizing them at every size
+        const std::shared_ptr<DistanceFieldAtlas> atlas = font.getDistanceFieldAtlas();
+        const float atlasScale = atlas ? atlas->getScale(characterSize) : 0;
+        if (atlas)
+            atlas->loadGlyphs(string, start, length, bold);
+
+        const float underlineOffset = font.getFont()->getUnderlinePosition(characterSize);
+        const float underlineThickness = font.getFont()->getUnderlineThickness(characterSize);
+        const sf::Vector2f lineTexCoords = atlas ? atlas->getSolidTexCoords() : sf::Vector2f{1, 1};
+
+        // The padding around the bounds of atlas glyphs is the same on both sides, so it doesn't change the center
+        const sf::FloatRect xBounds = atlas ? atlas->getGlyph('x', bold).bounds : font.getGlyph('x', characterSize, bold).bounds;
+        const float strikeThroughOffset = (xBounds.top + xBounds.height / 2.f) * (atlas ? atlasScale : 1);
+
+        const float whitespaceWidth = font.getGlyphAdvance(' ', characterSize, bold);
+        const float lineSpacing = font.getLineSpacing(characterSize);
+
+        float x = position.x;
+        float y = position.y + characterSize;
+        sf::Uint32 prevChar = 0;
+        for (std::size_t i = start; i < start + length; ++i)
+        {
+            const sf::Uint32 curChar = string[i];
+            x += font.getKerning(prevChar, curChar, characterSize);
+            prevChar = curChar;
+
+            if (curChar == ' ')
+                x += whitespaceWidth;
+            else if (curChar == '\t')
+                x += whitespaceWidth * 4;
+            else if (curChar == '\n')
+            {
+                if (x > position.x)
+                {
+                    if (underlined)
+                        addLine(vertices, position.x, x - position.x, y, color, underlineOffset, underlineThickness, lineTexCoords);
+                    if (strikeThrough)
+                        addLine(vertices, position.x, x - position.x, y, color, strikeThroughOffset, underlineThickness, lineTexCoords);
+                }
+
+                y += lineSpacing;
+                x = position.x;
+            }
+            else if (atlas)
+            {
+                const DistanceFieldAtlas::Glyph& glyph = atlas->getGlyph(curChar, bold);
+                addGlyphQuad(vertices, {x, y}, color, glyph, atlasScale, italicShear);
+                x += glyph.advance * atlasScale;
+            }
+            else
+            {
+                const sf::Glyph& glyph = font.getGlyph(curChar, characterSize, bold);
+                addGlyphQuad(vertices, {x, y}, color, glyph, italicShear);
+                x += glyph.advance;
+            }
+        }
+
+        if (x > position.x)
+        {
+            if (underlined)
+                addLine(vertices, position.x, x - position.x, y, color, underlineOffset, underlineThickness, lineTexCoords);
+            if (strikeThrough)
+                addLine(vertices, position.x, x - position.x, y, color, strikeThroughOffset, underlineThickness, lineTexCoords);
+        }
+
+        return x;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphRunCache::setMemoryLimit(std::size_t bytes)
+    {
+        Cache& cache = getCache();
+        cache.memoryLimit = bytes;
+        removeLeastRecentlyUsedEntries(cache);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t GlyphRunCache::getMemoryLimit()
+    {
+        return getCache().memoryLimit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    GlyphRunCache::Statistics GlyphRunCache::getStatistics()
+    {
+        return getCache().statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphRunCache::clear()
+    {
+        Cache& cache = getCache();
+        cache.entries.clear();
+        cache.lruList.clear();
+        cache.statistics = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
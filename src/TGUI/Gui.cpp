@@ -431,9 +431,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Gui::saveWidgetsToFile(const std::string& filename)
+    void Gui::saveWidgetsToFile(const std::string& filename, bool binary)
     {
-        m_container->saveWidgetsToFile(filename);
+        m_container->saveWidgetsToFile(filename, binary);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,708 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/InputValidator.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        const sf::Uint32 MaxCodePoint = std::numeric_limits<sf::Uint32>::max();
+        const unsigned int Infinite = std::numeric_limits<unsigned int>::max();
+        const std::size_t NoState = std::numeric_limits<std::size_t>::max();
+
+        // Patterns that would need larger automata than this are left to std::regex
+        const std::size_t MaxNfaStates = 10000;
+        const std::size_t MaxDfaStates = 2000;
+
+        // Thrown while compiling when the pattern contains something that can't be turned into an automaton
+        struct UnsupportedPattern {};
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        struct CharacterRange
+        {
+            sf::Uint32 first;
+            sf::Uint32 last;
+        };
+
+        // Sorted list of non-overlapping ranges
+        using CharacterSet = std::vector<CharacterRange>;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void normalize(CharacterSet& set)
+        {
+            std::sort(set.begin(), set.end(), [](const CharacterRange& left, const CharacterRange& right){ return left.first < right.first; });
+
+            CharacterSet merged;
+            for (const auto& range : set)
+            {
+                if (!merged.empty() && ((merged.back().last == MaxCodePoint) || (range.first <= merged.back().last + 1)))
+                    merged.back().last = std::max(merged.back().last, range.last);
+                else
+                    merged.push_back(range);
+            }
+
+            set = std::move(merged);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        CharacterSet complement(const CharacterSet& set)
+        {
+            CharacterSet result;
+            sf::Uint32 next = 0;
+            for (const auto& range : set)
+            {
+                if (range.first > next)
+                    result.push_back({next, range.first - 1});
+
+                if (range.last == MaxCodePoint)
+                    return result;
+
+                next = range.last + 1;
+            }
+
+            result.push_back({next, MaxCodePoint});
+            return result;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool contains(const CharacterSet& set, sf::Uint32 codePoint)
+        {
+            const auto it = std::upper_bound(set.begin(), set.end(), codePoint,
+                                             [](sf::Uint32 value, const CharacterRange& range){ return value < range.first; });
+
+            return (it != set.begin()) && (codePoint <= (it - 1)->last);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // State of the nondeterministic automaton, with at most one transition that reads a character
+        struct NfaState
+        {
+            std::vector<std::size_t> epsilon;
+            CharacterSet characters;
+            std::size_t next = NoState;
+        };
+
+        // Part of the nondeterministic automaton that was build for a part of the pattern
+        struct Fragment
+        {
+            std::size_t begin;
+            std::size_t end;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Recursive descent parser that directly builds a nondeterministic automaton (Thompson construction).
+        // Counted repetitions are build by parsing the repeated part of the pattern again for every copy.
+        class Parser
+        {
+        public:
+            Parser(const sf::String& pattern) :
+                m_pattern(pattern)
+            {
+            }
+
+            std::vector<NfaState> parse(std::size_t& startState, std::size_t& finalState)
+            {
+                const Fragment fragment = parseAlternatives();
+                if (m_position < m_pattern.getSize())
+                    throw UnsupportedPattern{};
+
+                startState = fragment.begin;
+                finalState = fragment.end;
+                return std::move(m_states);
+            }
+
+        private:
+            bool atEnd() const
+            {
+                return m_position >= m_pattern.getSize();
+            }
+
+            bool accept(sf::Uint32 c)
+            {
+                if (atEnd() || (m_pattern[m_position] != c))
+                    return false;
+
+                ++m_position;
+                return true;
+            }
+
+            sf::Uint32 read()
+            {
+                if (atEnd())
+                    throw UnsupportedPattern{};
+
+                return m_pattern[m_position++];
+            }
+
+            std::size_t addState()
+            {
+                if (m_states.size() >= MaxNfaStates)
+                    throw UnsupportedPattern{};
+
+                m_states.emplace_back();
+                return m_states.size() - 1;
+            }
+
+            void connect(std::size_t from, std::size_t to)
+            {
+                m_states[from].epsilon.push_back(to);
+            }
+
+            Fragment addCharacters(CharacterSet characters)
+            {
+                const Fragment fragment{addState(), addState()};
+                m_states[fragment.begin].characters = std::move(characters);
+                m_states[fragment.begin].next = fragment.end;
+                return fragment;
+            }
+
+            Fragment parseAlternatives()
+            {
+                const Fragment first = parseSequence();
+                if (atEnd() || (m_pattern[m_position] != '|'))
+                    return first;
+
+                const Fragment fragment{addState(), addState()};
+                connect(fragment.begin, first.begin);
+                connect(first.end, fragment.end);
+                while (accept('|'))
+                {
+                    const Fragment alternative = parseSequence();
+                    connect(fragment.begin, alternative.begin);
+                    connect(alternative.end, fragment.end);
+                }
+
+                return fragment;
+            }
+
+            Fragment parseSequence()
+            {
+                Fragment fragment{addState(), 0};
+                fragment.end = fragment.begin;
+                while (!atEnd() && (m_pattern[m_position] != '|') && (m_pattern[m_position] != ')'))
+                {
+                    const Fragment part = parseRepetition();
+                    connect(fragment.end, part.begin);
+                    fragment.end = part.end;
+                }
+
+                return fragment;
+            }
+
+            unsigned int parseNumber()
+            {
+                if (atEnd() || (m_pattern[m_position] < '0') || (m_pattern[m_position] > '9'))
+                    throw UnsupportedPattern{};
+
+                unsigned int number = 0;
+                while (!atEnd() && (m_pattern[m_position] >= '0') && (m_pattern[m_position] <= '9'))
+                {
+                    number = number * 10 + (m_pattern[m_position++] - '0');
+                    if (number > MaxNfaStates)
+                        throw UnsupportedPattern{};
+                }
+
+                return number;
+            }
+
+            Fragment parseRepetition()
+            {
+                const std::size_t atomPosition = m_position;
+                const Fragment atom = parseAtom();
+
+                unsigned int minCount;
+                unsigned int maxCount;
+                if (accept('*'))
+                {
+                    minCount = 0;
+                    maxCount = Infinite;
+                }
+                else if (accept('+'))
+                {
+                    minCount = 1;
+                    maxCount = Infinite;
+                }
+                else if (accept('?'))
+                {
+                    minCount = 0;
+                    maxCount = 1;
+                }
+                else if (accept('{'))
+                {
+                    minCount = parseNumber();
+                    if (accept(','))
+                        maxCount = accept('}') ? Infinite : parseNumber();
+                    else
+                        maxCount = minCount;
+
+                    if ((maxCount != Infinite) && !accept('}'))
+                        throw UnsupportedPattern{};
+                    if (maxCount < minCount)
+                        throw UnsupportedPattern{};
+                }
+                else
+                    return atom;
+
+                // A lazy quantifier matches the same texts when the whole text has to match
+                accept('?');
+
+                const std::size_t endPosition = m_position;
+                unsigned int copies = 0;
+                auto nextCopy = [&]
+                    {
+                        if (copies++ == 0)
+                            return atom;
+
+                        m_position = atomPosition;
+                        return parseAtom();
+                    };
+
+                Fragment fragment{addState(), 0};
+                fragment.end = fragment.begin;
+                for (unsigned int i = 0; i < minCount; ++i)
+                {
+                    const Fragment part = nextCopy();
+                    connect(fragment.end, part.begin);
+                    fragment.end = part.end;
+                }
+
+                if (maxCount == Infinite)
+                {
+                    const Fragment part = nextCopy();
+                    const std::size_t loop = addState();
+                    connect(fragment.end, loop);
+                    connect(loop, part.begin);
+                    connect(part.end, loop);
+                    fragment.end = loop;
+                }
+                else if (maxCount > minCount)
+                {
+                    const std::size_t end = addState();
+                    for (unsigned int i = minCount; i < maxCount; ++i)
+                    {
+                        const Fragment part = nextCopy();
+                        connect(fragment.end, end);
+                        connect(fragment.end, part.begin);
+                        fragment.end = part.end;
+                    }
+
+                    connect(fragment.end, end);
+                    fragment.end = end;
+                }
+
+                m_position = endPosition;
+                return fragment;
+            }
+
+            Fragment parseAtom()
+            {
+                const sf::Uint32 c = read();
+                switch (c)
+                {
+                    case '(':
+                    {
+                        // Only non-capturing groups are supported, lookaheads are not
+                        if (accept('?') && !accept(':'))
+                            throw UnsupportedPattern{};
+
+                        const Fragment fragment = parseAlternatives();
+                        if (!accept(')'))
+                            throw UnsupportedPattern{};
+
+                        return fragment;
+                    }
+                    case '[':
+                        return addCharacters(parseBracketExpression());
+                    case '.':
+                        return addCharacters(complement({{'\n', '\n'}, {'\r', '\r'}, {0x2028, 0x2029}}));
+                    case '\\':
+                    {
+                        bool isClass;
+                        return addCharacters(parseEscape(false, isClass));
+                    }
+                    case '^':
+                    case '$':
+                    {
+                        // Anchors are only meaningful at the start and end of the pattern, which the whole text has to match anyway
+                        if (((c == '^') && (m_position != 1)) || ((c == '$') && !atEnd()))
+                            throw UnsupportedPattern{};
+
+                        const std::size_t state = addState();
+                        return {state, state};
+                    }
+                    case '*':
+                    case '+':
+                    case '?':
+                    case '{':
+                    case '}':
+                    case ']':
+                    case ')':
+                    case '|':
+                        throw UnsupportedPattern{};
+                    default:
+                        return addCharacters({{c, c}});
+                }
+            }
+
+            CharacterSet parseEscape(bool inBracketExpression, bool& isClass)
+            {
+                static const CharacterSet digits{{'0', '9'}};
+                static const CharacterSet wordCharacters{{'0', '9'}, {'A', 'Z'}, {'_', '_'}, {'a', 'z'}};
+                static const CharacterSet whitespace{{'\t', '\r'}, {' ', ' '}};
+
+                isClass = true;
+                const sf::Uint32 c = read();
+                switch (c)
+                {
+                    case 'd': return digits;
+                    case 'D': return complement(digits);
+                    case 'w': return wordCharacters;
+                    case 'W': return complement(wordCharacters);
+                    case 's': return whitespace;
+                    case 'S': return complement(whitespace);
+                    default: break;
+                }
+
+                isClass = false;
+                sf::Uint32 codePoint;
+                switch (c)
+                {
+                    case 'n': codePoint = '\n'; break;
+                    case 't': codePoint = '\t'; break;
+                    case 'r': codePoint = '\r'; break;
+                    case 'f': codePoint = '\f'; break;
+                    case 'v': codePoint = '\v'; break;
+                    case 'x': codePoint = parseHexNumber(2); break;
+                    case 'u': codePoint = parseHexNumber(4); break;
+                    case '0':
+                    {
+                        if (!atEnd() && (m_pattern[m_position] >= '0') && (m_pattern[m_position] <= '9'))
+                            throw UnsupportedPattern{};
+
+                        codePoint = 0;
+                        break;
+                    }
+                    case 'b':
+                    {
+                        // Outside a bracket expression this is a word boundary
+                        if (!inBracketExpression)
+                            throw UnsupportedPattern{};
+
+                        codePoint = '\b';
+                        break;
+                    }
+                    default:
+                    {
+                        // Back-references, word boundaries and control characters are not supported
+                        if (((c >= '0') && (c <= '9')) || ((c >= 'A') && (c <= 'Z')) || ((c >= 'a') && (c <= 'z')))
+                            throw UnsupportedPattern{};
+
+                        codePoint = c;
+                        break;
+                    }
+                }
+
+                return {{codePoint, codePoint}};
+            }
+
+            sf::Uint32 parseHexNumber(unsigned int digitCount)
+            {
+                sf::Uint32 number = 0;
+                for (unsigned int i = 0; i < digitCount; ++i)
+                {
+                    const sf::Uint32 c = read();
+                    if ((c >= '0') && (c <= '9'))
+                        number = number * 16 + (c - '0');
+                    else if ((c >= 'a') && (c <= 'f'))
+                        number = number * 16 + (c - 'a' + 10);
+                    else if ((c >= 'A') && (c <= 'F'))
+                        number = number * 16 + (c - 'A' + 10);
+                    else
+                        throw UnsupportedPattern{};
+                }
+
+                return number;
+            }
+
+            CharacterSet parseBracketExpression()
+            {
+                const bool negated = accept('^');
+
+                // An empty class and the POSIX classes are left to std::regex
+                if (!atEnd() && (m_pattern[m_position] == ']'))
+                    throw UnsupportedPattern{};
+
+                CharacterSet characters;
+                while (!accept(']'))
+                {
+                    bool isClass;
+                    const CharacterSet first = parseClassAtom(isClass);
+
+                    if (!isClass && (m_position + 1 < m_pattern.getSize())
+                     && (m_pattern[m_position] == '-') && (m_pattern[m_position + 1] != ']'))
+                    {
+                        ++m_position;
+                        const CharacterSet last = parseClassAtom(isClass);
+                        if (isClass || (last[0].first < first[0].first))
+                            throw UnsupportedPattern{};
+
+                        characters.push_back({first[0].first, last[0].first});
+                    }
+                    else
+                        characters.insert(characters.end(), first.begin(), first.end());
+                }
+
+                normalize(characters);
+                if (negated)
+                    return complement(characters);
+                else
+                    return characters;
+            }
+
+            CharacterSet parseClassAtom(bool& isClass)
+            {
+                isClass = false;
+                const sf::Uint32 c = read();
+                if (c == '\\')
+                    return parseEscape(true, isClass);
+
+                if ((c == '[') && !atEnd() && ((m_pattern[m_position] == ':') || (m_pattern[m_position] == '.') || (m_pattern[m_position] == '=')))
+                    throw UnsupportedPattern{};
+
+                return {{c, c}};
+            }
+
+        private:
+            const sf::String m_pattern;
+            std::size_t m_position = 0;
+            std::vector<NfaState> m_states;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds all states that can be reached without reading a character and sorts the result.
+        // The visited vector has an element per state and is false again when the function returns.
+        void addEpsilonClosure(const std::vector<NfaState>& nfa, std::vector<std::size_t>& states, std::vector<bool>& visited)
+        {
+            std::sort(states.begin(), states.end());
+            states.erase(std::unique(states.begin(), states.end()), states.end());
+            for (const auto state : states)
+                visited[state] = true;
+
+            std::vector<std::size_t> stack = states;
+            while (!stack.empty())
+            {
+                const std::size_t state = stack.back();
+                stack.pop_back();
+
+                for (const auto next : nfa[state].epsilon)
+                {
+                    if (!visited[next])
+                    {
+                        visited[next] = true;
+                        states.push_back(next);
+                        stack.push_back(next);
+                    }
+                }
+            }
+
+            for (const auto state : states)
+                visited[state] = false;
+
+            std::sort(states.begin(), states.end());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InputValidator::InputValidator(const std::string& pattern) :
+        m_pattern{pattern}
+    {
+        std::size_t startState;
+        std::size_t finalState;
+        std::vector<NfaState> nfa;
+        try
+        {
+            nfa = Parser{sf::String::fromUtf8(pattern.begin(), pattern.end())}.parse(startState, finalState);
+        }
+        catch (const UnsupportedPattern&)
+        {
+            m_regex = std::regex{m_pattern};
+            return;
+        }
+
+        // Split the code points into ranges that are treated identically by all transitions
+        m_classStarts.push_back(0);
+        for (const auto& state : nfa)
+        {
+            for (const auto& range : state.characters)
+            {
+                m_classStarts.push_back(range.first);
+                if (range.last != MaxCodePoint)
+                    m_classStarts.push_back(range.last + 1);
+            }
+        }
+
+        std::sort(m_classStarts.begin(), m_classStarts.end());
+        m_classStarts.erase(std::unique(m_classStarts.begin(), m_classStarts.end()), m_classStarts.end());
+
+        for (sf::Uint32 c = 0; c < m_asciiClasses.size(); ++c)
+            m_asciiClasses[c] = static_cast<unsigned int>(std::upper_bound(m_classStarts.begin(), m_classStarts.end(), c) - m_classStarts.begin() - 1);
+
+        // Turn the nondeterministic automaton into a deterministic one (subset construction).
+        // The empty set becomes the dead state 0, the start state becomes state 1.
+        std::vector<bool> visited(nfa.size());
+        std::vector<std::vector<std::size_t>> stateSets{{}, {startState}};
+        addEpsilonClosure(nfa, stateSets[1], visited);
+
+        std::map<std::vector<std::size_t>, State> stateIds;
+        stateIds[stateSets[0]] = 0;
+        stateIds[stateSets[1]] = 1;
+
+        for (std::size_t i = 0; i < stateSets.size(); ++i)
+        {
+            const std::vector<std::size_t> stateSet = stateSets[i];
+            m_accepting.push_back(std::binary_search(stateSet.begin(), stateSet.end(), finalState));
+
+            for (const auto classStart : m_classStarts)
+            {
+                std::vector<std::size_t> nextSet;
+                for (const auto state : stateSet)
+                {
+                    if ((nfa[state].next != NoState) && contains(nfa[state].characters, classStart))
+                        nextSet.push_back(nfa[state].next);
+                }
+
+                addEpsilonClosure(nfa, nextSet, visited);
+
+                const auto it = stateIds.find(nextSet);
+                if (it != stateIds.end())
+                    m_transitions.push_back(it->second);
+                else
+                {
+                    if (stateSets.size() >= MaxDfaStates)
+                    {
+                        m_classStarts.clear();
+                        m_transitions.clear();
+                        m_accepting.clear();
+                        m_regex = std::regex{m_pattern};
+                        return;
+                    }
+
+                    const State newState = static_cast<State>(stateSets.size());
+                    stateIds[nextSet] = newState;
+                    stateSets.push_back(std::move(nextSet));
+                    m_transitions.push_back(newState);
+                }
+            }
+        }
+
+        m_compiled = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& InputValidator::getPattern() const
+    {
+        return m_pattern;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputValidator::isCompiled() const
+    {
+        return m_compiled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InputValidator::State InputValidator::getStartState() const
+    {
+        return 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InputValidator::State InputValidator::getNextState(State state, sf::Uint32 codePoint) const
+    {
+        return m_transitions[state * m_classStarts.size() + findCharacterClass(codePoint)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InputValidator::State InputValidator::getNextState(State state, const sf::String& text, std::size_t start) const
+    {
+        const std::size_t classCount = m_classStarts.size();
+        for (std::size_t i = start; (i < text.getSize()) && (state != 0); ++i)
+            state = m_transitions[state * classCount + findCharacterClass(text[i])];
+
+        return state;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputValidator::isAccepting(State state) const
+    {
+        return m_compiled && m_accepting[state];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputValidator::match(const sf::String& text) const
+    {
+        if (m_compiled)
+            return m_accepting[getNextState(getStartState(), text)];
+        else
+            return std::regex_match(text.toAnsiString(), m_regex);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t InputValidator::findCharacterClass(sf::Uint32 codePoint) const
+    {
+        if (codePoint < m_asciiClasses.size())
+            return m_asciiClasses[codePoint];
+        else
+            return static_cast<std::size_t>(std::upper_bound(m_classStarts.begin(), m_classStarts.end(), codePoint) - m_classStarts.begin() - 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
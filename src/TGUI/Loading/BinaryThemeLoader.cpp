@@ -0,0 +1,658 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Loading/BinaryThemeLoader.hpp>
+#include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/Loading/ResourcePack.hpp>
+#include <TGUI/Global.hpp>
+#include <TGUI/to_string.hpp>
+
+#include <fstream>
+
+#ifdef SFML_SYSTEM_WINDOWS
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Layout of the file (all integers are stored as 32-bit little-endian values):
+        //   magic "TGBT", version
+        //   string count, for each string: length, UTF-8 bytes
+        //   renderer count, for each renderer: property count, for each property: name index, value kind, value index
+        //   section count, for each section: name index, renderer index
+        // Nested renderers are always stored before the renderer that uses them.
+        const char binaryThemeMagic[4] = {'T', 'G', 'B', 'T'};
+        const std::uint32_t binaryThemeVersion = 1;
+
+        enum class ValueKind : std::uint32_t
+        {
+            String = 0,   ///< Index in the string table
+            Renderer = 1, ///< Index in the renderer table
+            Texture = 2   ///< Index in the string table, the filename is relative to the binary theme file
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeUint32(std::string& buffer, std::uint32_t value)
+        {
+            buffer.push_back(static_cast<char>(value & 0xFF));
+            buffer.push_back(static_cast<char>((value >> 8) & 0xFF));
+            buffer.push_back(static_cast<char>((value >> 16) & 0xFF));
+            buffer.push_back(static_cast<char>((value >> 24) & 0xFF));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint32_t readUint32(const unsigned char* data)
+        {
+            return static_cast<std::uint32_t>(data[0])
+                 | (static_cast<std::uint32_t>(data[1]) << 8)
+                 | (static_cast<std::uint32_t>(data[2]) << 16)
+                 | (static_cast<std::uint32_t>(data[3]) << 24);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Strings are stored as UTF-8 so that values outside the ANSI range are kept exactly as the text loader returns them
+        std::string toUtf8(const sf::String& str)
+        {
+            const auto utf8 = str.toUtf8();
+            return std::string(utf8.begin(), utf8.end());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::String fromUtf8(const std::string& str)
+        {
+            return sf::String::fromUtf8(str.begin(), str.end());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string getDirectory(const std::string& filename)
+        {
+            auto slashPos = filename.find_last_of("/\\");
+            if (slashPos != std::string::npos)
+                return filename.substr(0, slashPos+1);
+            else
+                return "";
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isTextureProperty(const std::string& property)
+        {
+            return (property.size() >= 7) && (property.compare(0, 7, "texture") == 0);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Reads the file with bounds checking, a corrupt file results in an exception instead of reading out of bounds
+        class BinaryReader
+        {
+        public:
+            BinaryReader(const unsigned char* data, std::size_t size, const std::string& filename) :
+                m_data    {data},
+                m_size    {size},
+                m_filename{filename}
+            {
+            }
+
+            std::uint32_t readUint32()
+            {
+                const unsigned char* bytes = readBytes(4);
+                return tgui::readUint32(bytes);
+            }
+
+            const unsigned char* readBytes(std::size_t count)
+            {
+                if (count > m_size - m_pos)
+                    throw Exception{"Unexpected end of binary theme file '" + m_filename + "'."};
+
+                const unsigned char* bytes = m_data + m_pos;
+                m_pos += count;
+                return bytes;
+            }
+
+            std::size_t getPosition() const
+            {
+                return m_pos;
+            }
+
+        private:
+            const unsigned char* m_data;
+            std::size_t m_size;
+            std::size_t m_pos = 0;
+            const std::string& m_filename;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Builds the contents of the binary file while the theme is being compiled
+        class BinaryThemeWriter
+        {
+        public:
+            BinaryThemeWriter(const std::string& themeDirectory) :
+                m_themeDirectory{themeDirectory}
+            {
+            }
+
+            std::uint32_t addString(const std::string& str)
+            {
+                const auto it = m_stringIndices.find(str);
+                if (it != m_stringIndices.end())
+                    return it->second;
+
+                const auto index = static_cast<std::uint32_t>(m_stringIndices.size());
+                m_stringIndices[str] = index;
+                writeUint32(m_strings, static_cast<std::uint32_t>(str.size()));
+                m_strings += str;
+                return index;
+            }
+
+            std::uint32_t addRenderer(const std::map<std::string, ObjectConverter>& properties)
+            {
+                std::string record;
+                writeUint32(record, static_cast<std::uint32_t>(properties.size()));
+                for (const auto& pair : properties)
+                {
+                    writeUint32(record, addString(pair.first));
+
+                    // Nested renderers are stored separately, sections that are used in several places are only stored once
+                    if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                    {
+                        const std::uint32_t nestedIndex = addRenderer(ObjectConverter{pair.second}.getRenderer()->propertyValuePairs);
+                        writeUint32(record, static_cast<std::uint32_t>(ValueKind::Renderer));
+                        writeUint32(record, nestedIndex);
+                    }
+                    else if (isTextureProperty(pair.first))
+                    {
+                        writeUint32(record, static_cast<std::uint32_t>(ValueKind::Texture));
+                        writeUint32(record, addString(removeThemeDirectory(ObjectConverter{pair.second}.getString())));
+                    }
+                    else
+                    {
+                        writeUint32(record, static_cast<std::uint32_t>(ValueKind::String));
+                        writeUint32(record, addString(toUtf8(ObjectConverter{pair.second}.getString())));
+                    }
+                }
+
+                const auto it = m_rendererIndices.find(record);
+                if (it != m_rendererIndices.end())
+                    return it->second;
+
+                const auto index = static_cast<std::uint32_t>(m_rendererIndices.size());
+                m_rendererIndices[record] = index;
+                m_renderers += record;
+                return index;
+            }
+
+            void addSection(const std::string& name, const std::map<std::string, ObjectConverter>& properties)
+            {
+                const std::uint32_t rendererIndex = addRenderer(properties);
+                writeUint32(m_sections, addString(name));
+                writeUint32(m_sections, rendererIndex);
+                m_sectionCount++;
+            }
+
+            std::string getContents() const
+            {
+                std::string contents(binaryThemeMagic, sizeof(binaryThemeMagic));
+                writeUint32(contents, binaryThemeVersion);
+                writeUint32(contents, static_cast<std::uint32_t>(m_stringIndices.size()));
+                contents += m_strings;
+                writeUint32(contents, static_cast<std::uint32_t>(m_rendererIndices.size()));
+                contents += m_renderers;
+                writeUint32(contents, m_sectionCount);
+                contents += m_sections;
+                return contents;
+            }
+
+        private:
+
+            // The theme loader made the texture filenames relative to the working directory,
+            // in the binary file they are stored relative to the file itself.
+            std::string removeThemeDirectory(sf::String str) const
+            {
+                const sf::String themeDirectory = m_themeDirectory;
+                const auto quotePos = str.find('"');
+                if (!themeDirectory.isEmpty() && (quotePos != sf::String::InvalidPos)
+                 && (str.substring(quotePos + 1, themeDirectory.getSize()) == themeDirectory))
+                {
+                    str.erase(quotePos + 1, themeDirectory.getSize());
+                }
+
+                return toUtf8(str);
+            }
+
+        private:
+            std::string m_themeDirectory;
+            std::map<std::string, std::uint32_t> m_stringIndices;
+            std::map<std::string, std::uint32_t> m_rendererIndices;
+            std::string m_strings;
+            std::string m_renderers;
+            std::string m_sections;
+            std::uint32_t m_sectionCount = 0;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct BinaryThemeLoader::ThemeFile
+    {
+        ThemeFile(const std::string& filename);
+        ~ThemeFile();
+
+        void map(const std::string& fullFilename);
+        void unmap();
+
+        ThemeFile(const ThemeFile&) = delete;
+        ThemeFile& operator=(const ThemeFile&) = delete;
+
+        std::string getString(std::uint32_t index) const
+        {
+            return {reinterpret_cast<const char*>(data + strings[index].first), strings[index].second};
+        }
+
+        const unsigned char* data = nullptr;
+        std::size_t size = 0;
+        ResourcePack::ConstPtr pack; // Set when the file was found in a mounted resource pack instead of being mapped
+
+    #ifdef SFML_SYSTEM_WINDOWS
+        HANDLE fileHandle = INVALID_HANDLE_VALUE;
+        HANDLE mappingHandle = nullptr;
+    #endif
+
+        std::string directory;
+        std::vector<std::pair<std::size_t, std::size_t>> strings; // Offset and length of each string
+        std::vector<std::size_t> renderers; // Offset of each renderer
+        std::map<std::string, std::uint32_t> sections; // Lowercase section name mapped to its renderer index
+        std::map<std::uint32_t, std::shared_ptr<RendererData>> rendererCache; // Renderer index mapped to the created renderer
+        std::map<std::string, const std::map<sf::String, sf::String>*> propertiesCache; // Only filled when load is called
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BinaryThemeLoader::ThemeFile::ThemeFile(const std::string& filename) :
+        directory{getDirectory(filename)}
+    {
+        const std::string fullFilename = getResourcePath() + filename;
+
+        const char* packedData;
+        pack = ResourcePack::findMountedFile(filename, packedData, size);
+        if (pack)
+            data = reinterpret_cast<const unsigned char*>(packedData);
+        else
+            map(fullFilename);
+
+        // Read the tables and validate all indices, so that they no longer have to be checked when creating renderers
+        try
+        {
+            BinaryReader reader{data, size, filename};
+            if (std::string(reinterpret_cast<const char*>(reader.readBytes(sizeof(binaryThemeMagic))), sizeof(binaryThemeMagic))
+             != std::string(binaryThemeMagic, sizeof(binaryThemeMagic)))
+                throw Exception{"File '" + filename + "' is not a binary theme file."};
+
+            const std::uint32_t version = reader.readUint32();
+            if (version != binaryThemeVersion)
+                throw Exception{"Binary theme file '" + filename + "' has unsupported version " + to_string(version) + "."};
+
+            const std::uint32_t stringCount = reader.readUint32();
+            for (std::uint32_t i = 0; i < stringCount; ++i)
+            {
+                const std::uint32_t length = reader.readUint32();
+                strings.emplace_back(reader.getPosition(), length);
+                reader.readBytes(length);
+            }
+
+            const std::uint32_t rendererCount = reader.readUint32();
+            for (std::uint32_t i = 0; i < rendererCount; ++i)
+            {
+                renderers.push_back(reader.getPosition());
+
+                const std::uint32_t propertyCount = reader.readUint32();
+                for (std::uint32_t j = 0; j < propertyCount; ++j)
+                {
+                    const std::uint32_t nameIndex = reader.readUint32();
+                    const std::uint32_t kind = reader.readUint32();
+                    const std::uint32_t valueIndex = reader.readUint32();
+
+                    bool valid = (nameIndex < stringCount);
+                    if (kind == static_cast<std::uint32_t>(ValueKind::Renderer))
+                        valid = valid && (valueIndex < i); // Also guarantees that renderers can't contain themselves
+                    else if ((kind == static_cast<std::uint32_t>(ValueKind::String)) || (kind == static_cast<std::uint32_t>(ValueKind::Texture)))
+                        valid = valid && (valueIndex < stringCount);
+                    else
+                        valid = false;
+
+                    if (!valid)
+                        throw Exception{"Binary theme file '" + filename + "' is corrupt."};
+                }
+            }
+
+            const std::uint32_t sectionCount = reader.readUint32();
+            for (std::uint32_t i = 0; i < sectionCount; ++i)
+            {
+                const std::uint32_t nameIndex = reader.readUint32();
+                const std::uint32_t rendererIndex = reader.readUint32();
+                if ((nameIndex >= stringCount) || (rendererIndex >= rendererCount))
+                    throw Exception{"Binary theme file '" + filename + "' is corrupt."};
+
+                sections[getString(nameIndex)] = rendererIndex;
+            }
+        }
+        catch (...)
+        {
+            unmap();
+            throw;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BinaryThemeLoader::ThemeFile::~ThemeFile()
+    {
+        unmap();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryThemeLoader::ThemeFile::map(const std::string& fullFilename)
+    {
+    #ifdef SFML_SYSTEM_WINDOWS
+        fileHandle = CreateFileA(fullFilename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+            throw Exception{"Failed to open binary theme file '" + fullFilename + "'."};
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize))
+        {
+            CloseHandle(fileHandle);
+            throw Exception{"Failed to open binary theme file '" + fullFilename + "'."};
+        }
+
+        size = static_cast<std::size_t>(fileSize.QuadPart);
+        if (size > 0)
+        {
+            mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mappingHandle)
+                data = static_cast<const unsigned char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+
+            if (!data)
+            {
+                if (mappingHandle)
+                    CloseHandle(mappingHandle);
+                CloseHandle(fileHandle);
+                throw Exception{"Failed to map binary theme file '" + fullFilename + "' in memory."};
+            }
+        }
+    #else
+        const int fileDescriptor = open(fullFilename.c_str(), O_RDONLY);
+        if (fileDescriptor < 0)
+            throw Exception{"Failed to open binary theme file '" + fullFilename + "'."};
+
+        struct stat fileInfo;
+        if (fstat(fileDescriptor, &fileInfo) != 0)
+        {
+            close(fileDescriptor);
+            throw Exception{"Failed to open binary theme file '" + fullFilename + "'."};
+        }
+
+        size = static_cast<std::size_t>(fileInfo.st_size);
+        if (size > 0)
+        {
+            void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+            if (mapping == MAP_FAILED)
+            {
+                close(fileDescriptor);
+                throw Exception{"Failed to map binary theme file '" + fullFilename + "' in memory."};
+            }
+
+            data = static_cast<const unsigned char*>(mapping);
+        }
+
+        // The mapping remains valid after the file is closed
+        close(fileDescriptor);
+    #endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryThemeLoader::ThemeFile::unmap()
+    {
+        // Files inside a resource pack remain mapped for as long as the pack exists
+        if (pack)
+        {
+            pack = nullptr;
+            data = nullptr;
+            return;
+        }
+
+    #ifdef SFML_SYSTEM_WINDOWS
+        if (data)
+            UnmapViewOfFile(data);
+        if (mappingHandle)
+            CloseHandle(mappingHandle);
+        if (fileHandle != INVALID_HANDLE_VALUE)
+            CloseHandle(fileHandle);
+
+        mappingHandle = nullptr;
+        fileHandle = INVALID_HANDLE_VALUE;
+    #else
+        if (data)
+            munmap(const_cast<unsigned char*>(data), size);
+    #endif
+
+        data = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BinaryThemeLoader::BinaryThemeLoader() = default;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BinaryThemeLoader::~BinaryThemeLoader() = default;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryThemeLoader::preload(const std::string& filename)
+    {
+        if (filename == "")
+            return;
+
+        getThemeFile(filename);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::map<sf::String, sf::String>& BinaryThemeLoader::load(const std::string& filename, const std::string& section)
+    {
+        // An empty filename is not considered an error and will result in an empty property list
+        if (filename == "")
+        {
+            static const std::map<sf::String, sf::String> emptyProperties;
+            return emptyProperties;
+        }
+
+        const std::shared_ptr<ThemeFile> file = getThemeFile(filename);
+
+        const std::string lowercaseSection = toLower(section);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto cacheIt = file->propertiesCache.find(lowercaseSection);
+            if (cacheIt != file->propertiesCache.end())
+                return *cacheIt->second;
+        }
+
+        std::map<sf::String, sf::String> properties;
+        for (const auto& pair : loadRenderer(filename, section)->propertyValuePairs)
+        {
+            if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                properties[pair.first] = "{\n" + Serializer::serialize(ObjectConverter{pair.second}) + "}";
+            else
+                properties[pair.first] = ObjectConverter{pair.second}.getString();
+        }
+
+        // Identical sections of reloaded files share the same properties
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto& storedProperties = *m_loadedProperties.insert(std::move(properties)).first;
+        file->propertiesCache[lowercaseSection] = &storedProperties;
+        return storedProperties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<RendererData> BinaryThemeLoader::loadRenderer(const std::string& filename, const std::string& section)
+    {
+        // An empty filename is not considered an error and will result in an empty property list
+        if (filename == "")
+            return RendererData::createCopyOnWrite({});
+
+        const std::shared_ptr<ThemeFile> file = getThemeFile(filename);
+
+        const auto sectionIt = file->sections.find(toLower(section));
+        if (sectionIt == file->sections.end())
+            throw Exception{"No section '" + section + "' was found in file '" + filename + "'."};
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return createRendererData(*file, sectionIt->second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::string> BinaryThemeLoader::getSectionNames(const std::string& filename)
+    {
+        if (filename == "")
+            return {};
+
+        std::vector<std::string> sectionNames;
+        for (const auto& section : getThemeFile(filename)->sections)
+            sectionNames.push_back(section.first);
+
+        return sectionNames;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryThemeLoader::flushCache(const std::string& filename)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (filename != "")
+            m_themeFiles.erase(filename);
+        else
+            m_themeFiles.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryThemeLoader::compile(const std::string& themeFilename, const std::string& outputFilename)
+    {
+        DefaultThemeLoader themeLoader;
+        BinaryThemeWriter writer{getDirectory(themeFilename)};
+        for (const auto& section : themeLoader.getSectionNames(themeFilename))
+            writer.addSection(section, themeLoader.loadRenderer(themeFilename, section)->propertyValuePairs);
+
+        const std::string contents = writer.getContents();
+
+        std::ofstream file{getResourcePath() + outputFilename, std::ios::binary};
+        if (!file.is_open())
+            throw Exception{"Failed to open '" + getResourcePath() + outputFilename + "' for writing."};
+
+        file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+        if (!file)
+            throw Exception{"Failed to write binary theme file '" + getResourcePath() + outputFilename + "'."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BinaryThemeLoader::ThemeFile> BinaryThemeLoader::getThemeFile(const std::string& filename)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_themeFiles.find(filename);
+        if (it == m_themeFiles.end())
+            it = m_themeFiles.emplace(filename, std::make_shared<ThemeFile>(filename)).first;
+
+        return it->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<RendererData> BinaryThemeLoader::createRendererData(ThemeFile& file, std::uint32_t index) const
+    {
+        // Every renderer is only created once, all sections that use it share it until they change it
+        auto& rendererData = file.rendererCache[index];
+        if (rendererData)
+            return rendererData;
+
+        // The indices were validated when the file was loaded
+        rendererData = RendererData::createCopyOnWrite({});
+        const unsigned char* record = file.data + file.renderers[index];
+        const std::uint32_t propertyCount = readUint32(record);
+        for (std::uint32_t i = 0; i < propertyCount; ++i)
+        {
+            const unsigned char* property = record + 4 + (i * 12);
+            const std::uint32_t nameIndex = readUint32(property);
+            const std::uint32_t kind = readUint32(property + 4);
+            const std::uint32_t valueIndex = readUint32(property + 8);
+
+            ObjectConverter& value = rendererData->propertyValuePairs[file.getString(nameIndex)];
+            if (kind == static_cast<std::uint32_t>(ValueKind::Renderer))
+                value = {createRendererData(file, valueIndex)};
+            else if (kind == static_cast<std::uint32_t>(ValueKind::Texture))
+            {
+                sf::String str = fromUtf8(file.getString(valueIndex));
+
+                ///TODO: Detect absolute pathname on windows
+                const auto quotePos = str.find('"');
+                if (!file.directory.empty() && (quotePos != sf::String::InvalidPos) && (str.getSize() > quotePos + 1) && (str[quotePos+1] != '/'))
+                    str.insert(quotePos + 1, file.directory);
+
+                value = {str};
+            }
+            else
+                value = {fromUtf8(file.getString(valueIndex))};
+        }
+
+        return rendererData;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
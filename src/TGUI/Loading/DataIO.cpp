@@ -26,6 +26,8 @@
 #include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/Global.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <cctype>
 #include <cassert>
 
@@ -34,38 +36,21 @@
 #define REMOVE_WHITESPACE_AND_COMMENTS(ReturnErrorOnEOF) \
     for (;;) \
     { \
-        stream >> std::ws; \
+        stream.skipWhitespace(); \
         if (stream.peek() == EOF) \
             break; \
         \
         if (stream.peek() == '/') \
         { \
-            char c; \
-            stream.read(&c, 1); \
+            stream.read(); \
             if (stream.peek() == '/') \
             { \
-                while (stream.peek() != EOF) \
-                { \
-                    stream.read(&c, 1); \
-                    if (c == '\n') \
-                        break; \
-                } \
+                stream.skipLine(); \
             } \
             else if (stream.peek() == '*') \
             { \
-                while (stream.peek() != EOF) \
-                { \
-                    stream.read(&c, 1); \
-                    if (stream.peek() == '*') \
-                    { \
-                        stream.read(&c, 1); \
-                        if (stream.peek() == '/') \
-                        { \
-                            stream.read(&c, 1); \
-                            break; \
-                        } \
-                    } \
-                } \
+                stream.read(); \
+                stream.skipBlockComment(); \
                 continue; \
             } \
             else \
@@ -90,73 +75,171 @@ namespace tgui
 {
     namespace
     {
+        // Reads characters from a contiguous buffer and keeps track of the line number while doing so
+        class InputBuffer
+        {
+        public:
+            InputBuffer(const char* data, std::size_t size) :
+                m_pos{data},
+                m_end{data + size}
+            {
+            }
+
+            int peek() const
+            {
+                return (m_pos != m_end) ? static_cast<unsigned char>(*m_pos) : EOF;
+            }
+
+            int peek(std::size_t offset) const
+            {
+                return (offset < static_cast<std::size_t>(m_end - m_pos)) ? static_cast<unsigned char>(m_pos[offset]) : EOF;
+            }
+
+            char read()
+            {
+                assert(m_pos != m_end);
+                if (*m_pos == '\n')
+                    ++m_lineNumber;
+
+                return *m_pos++;
+            }
+
+            const char* getPosition() const
+            {
+                return m_pos;
+            }
+
+            // Skips characters of which the caller knows that they aren't newlines
+            void skip(const char* pos)
+            {
+                assert((pos >= m_pos) && (pos <= m_end));
+                m_pos = pos;
+            }
+
+            const char* getEnd() const
+            {
+                return m_end;
+            }
+
+            void skipWhitespace()
+            {
+                while ((m_pos != m_end) && ::isspace(static_cast<unsigned char>(*m_pos)))
+                    read();
+            }
+
+            // Skips until after the next newline character
+            void skipLine()
+            {
+                while (m_pos != m_end)
+                {
+                    if (read() == '\n')
+                        break;
+                }
+            }
+
+            // Skips until after the next "*/", or until the end of the input if the comment isn't closed
+            void skipBlockComment()
+            {
+                while (m_pos != m_end)
+                {
+                    if ((read() == '*') && (peek() == '/'))
+                    {
+                        read();
+                        break;
+                    }
+                }
+            }
+
+            std::size_t getLineNumber() const
+            {
+                return m_lineNumber;
+            }
+
+        private:
+            const char* m_pos;
+            const char* m_end;
+            std::size_t m_lineNumber = 1;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Characters that end a word when reading the name of a section or property
+        bool isWordSeparator(char c)
+        {
+            return ::isspace(static_cast<unsigned char>(c)) || (c == '=') || (c == ';') || (c == '{') || (c == '}');
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Reads a quoted string (the opening quote has already been read) and adds it to the output.
+        // Returns false when the end of the input was reached before the closing quote.
+        bool readQuotedString(InputBuffer& stream, std::string& output)
+        {
+            bool backslash = false;
+            while (stream.peek() != EOF)
+            {
+                const char c = stream.read();
+                output.push_back(c);
+
+                if (c == '"' && !backslash)
+                    return true;
+
+                if (c == '\\' && !backslash)
+                    backslash = true;
+                else
+                    backslash = false;
+            }
+
+            return false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         // Forward declare one of the functions to solve circular dependency
-        std::string parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName);
+        std::string parseSection(InputBuffer& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string readWord(std::stringstream& stream)
+        std::string readWord(InputBuffer& stream)
         {
             std::string word = "";
             while (stream.peek() != EOF)
             {
-                char c = stream.peek();
+                char c = static_cast<char>(stream.peek());
                 if (c == '\r')
                 {
-                    stream.read(&c, 1);
+                    stream.read();
                     return word;
                 }
-                else if (!::isspace(c) && (c != '=') && (c != ';') && (c != '{') && (c != '}'))
+                else if (!isWordSeparator(c))
                 {
-                    stream.read(&c, 1);
-
-                    if ((c == '/') && (stream.peek() == '/'))
+                    if ((c == '/') && (stream.peek(1) == '/'))
                     {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                            {
-                                assert(!word.empty()); // No known case in which you can pass here with an empty word
-                                return word;
-                            }
-                        }
+                        stream.skipLine();
+                        assert(!word.empty()); // No known case in which you can pass here with an empty word
+                        return word;
                     }
-                    else if ((c == '/') && (stream.peek() == '*'))
+                    else if ((c == '/') && (stream.peek(1) == '*'))
                     {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '*')
-                            {
-                                if (stream.peek() == '/')
-                                {
-                                    stream.read(&c, 1);
-                                    break;
-                                }
-                            }
-                        }
+                        stream.read();
+                        stream.skipBlockComment();
                     }
                     else if (c == '"')
                     {
-                        word.push_back(c);
-                        bool backslash = false;
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            word.push_back(c);
-
-                            if (c == '"' && !backslash)
-                                break;
-
-                            if (c == '\\' && !backslash)
-                                backslash = true;
-                            else
-                                backslash = false;
-                        }
+                        word.push_back(stream.read());
+                        readQuotedString(stream, word);
                     }
                     else
-                        word.push_back(c);
+                    {
+                        // Add all normal characters at once, they can't contain a newline
+                        const char* runStart = stream.getPosition();
+                        const char* runEnd = runStart + 1;
+                        while ((runEnd != stream.getEnd()) && !isWordSeparator(*runEnd) && (*runEnd != '/') && (*runEnd != '"'))
+                            ++runEnd;
+
+                        word.append(runStart, runEnd);
+                        stream.skip(runEnd);
+                    }
                 }
                 else
                     return word;
@@ -167,42 +250,23 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string readLine(std::stringstream& stream)
+        std::string readLine(InputBuffer& stream)
         {
             std::string line;
             bool whitespaceFound = false;
             while (stream.peek() != EOF)
             {
-                char c = stream.peek();
+                char c = static_cast<char>(stream.peek());
 
-                if (stream.peek() == '/')
+                if (c == '/')
                 {
-                    stream.read(&c, 1);
+                    stream.read();
                     if (stream.peek() == '/')
-                    {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                                break;
-                        }
-                    }
+                        stream.skipLine();
                     else if (stream.peek() == '*')
                     {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (stream.peek() == '*')
-                            {
-                                stream.read(&c, 1);
-                                if (stream.peek() == '/')
-                                {
-                                    stream.read(&c, 1);
-                                    break;
-                                }
-                            }
-                        }
-                        continue;
+                        stream.read();
+                        stream.skipBlockComment();
                     }
                     else
                         return "";
@@ -212,28 +276,11 @@ namespace tgui
 
                 if (c == '"')
                 {
-                    stream.read(&c, 1);
-                    line.push_back(c);
-
-                    bool backslash = false;
-                    while (stream.peek() != EOF)
-                    {
-                        stream.read(&c, 1);
-                        line.push_back(c);
-
-                        if (c == '"' && !backslash)
-                            break;
-
-                        if (c == '\\' && !backslash)
-                            backslash = true;
-                        else
-                            backslash = false;
-                    }
-
-                    if (stream.peek() == EOF)
+                    line.push_back(stream.read());
+                    if (!readQuotedString(stream, line) || (stream.peek() == EOF))
                         return "";
 
-                    c = stream.peek();
+                    c = static_cast<char>(stream.peek());
                 }
 
                 if ((c == '=') || (c == '{'))
@@ -244,9 +291,9 @@ namespace tgui
                     line.erase(line.find_last_not_of(" \n\r\t")+1);
                     return line;
                 }
-                else if (::isspace(c))
+                else if (::isspace(static_cast<unsigned char>(c)))
                 {
-                    stream.read(&c, 1);
+                    stream.read();
                     if (!whitespaceFound)
                     {
                         whitespaceFound = true;
@@ -255,9 +302,18 @@ namespace tgui
                 }
                 else
                 {
+                    // Add all normal characters at once, they can't contain a newline
                     whitespaceFound = false;
-                    line.push_back(c);
-                    stream.read(&c, 1);
+                    const char* runStart = stream.getPosition();
+                    const char* runEnd = runStart + 1;
+                    while ((runEnd != stream.getEnd()) && !::isspace(static_cast<unsigned char>(*runEnd))
+                        && (*runEnd != '/') && (*runEnd != '"') && (*runEnd != '=') && (*runEnd != '{') && (*runEnd != ';') && (*runEnd != '}'))
+                    {
+                        ++runEnd;
+                    }
+
+                    line.append(runStart, runEnd);
+                    stream.skip(runEnd);
                 }
             }
 
@@ -266,11 +322,81 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseKeyValue(std::stringstream& stream, std::unique_ptr<DataIO::Node>& node, const std::string& key)
+        // Splits the value into its items, returns false when the value isn't a list
+        bool splitList(const std::string& line, std::vector<std::string>& items)
+        {
+            if ((line.size() < 2) || (line[0] != '[') || (line.back() != ']'))
+                return false;
+
+            if (line.size() >= 3)
+            {
+                std::string item;
+                std::size_t i = 1;
+                while (i < line.size()-1)
+                {
+                    if (line[i] == ',')
+                    {
+                        i++;
+                        items.push_back(trim(item));
+                        item.clear();
+                    }
+                    else if (line[i] == '"')
+                    {
+                        item.push_back(line[i]);
+                        i++;
+
+                        bool backslash = false;
+                        while (i < line.size()-1)
+                        {
+                            item.push_back(line[i]);
+
+                            if (line[i] == '"' && !backslash)
+                            {
+                                i++;
+                                break;
+                            }
+
+                            if (line[i] == '\\' && !backslash)
+                                backslash = true;
+                            else
+                                backslash = false;
+
+                            i++;
+                        }
+                    }
+                    else
+                    {
+                        item.push_back(line[i]);
+                        i++;
+                    }
+                }
+
+                items.push_back(trim(item));
+            }
+
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Splits the value into its items when it is a list
+        void splitList(DataIO::ValueNode& valueNode, const std::string& line)
+        {
+            std::vector<std::string> items;
+            if (!splitList(line, items))
+                return;
+
+            valueNode.listNode = true;
+            for (const auto& item : items)
+                valueNode.valueList.push_back(item);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string parseKeyValue(InputBuffer& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& key)
         {
             // Read the assignment symbol from the stream and remove the whitespace behind it
-            char chr;
-            stream.read(&chr, 1);
+            stream.read();
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
 
@@ -284,63 +410,14 @@ namespace tgui
             {
                 // Remove the ';' if it is there
                 if (stream.peek() == ';')
-                    stream.read(&chr, 1);
+                    stream.read();
 
                 // Create a value node to store the value
                 auto valueNode = std::make_unique<DataIO::ValueNode>();
                 valueNode->value = line;
 
                 // It might be a list node
-                if ((line.size() >= 2) && (line[0] == '[') && (line.back() == ']'))
-                {
-                    valueNode->listNode = true;
-                    if (line.size() >= 3)
-                    {
-                        valueNode->valueList.push_back("");
-
-                        std::size_t i = 1;
-                        while (i < line.size()-1)
-                        {
-                            if (line[i] == ',')
-                            {
-                                i++;
-                                valueNode->valueList.back() = trim(valueNode->valueList.back());
-                                valueNode->valueList.push_back("");
-                            }
-                            else if (line[i] == '"')
-                            {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
-                                i++;
-
-                                bool backslash = false;
-                                while (i < line.size()-1)
-                                {
-                                    valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
-
-                                    if (line[i] == '"' && !backslash)
-                                    {
-                                        i++;
-                                        break;
-                                    }
-
-                                    if (line[i] == '\\' && !backslash)
-                                        backslash = true;
-                                    else
-                                        backslash = false;
-
-                                    i++;
-                                }
-                            }
-                            else
-                            {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
-                                i++;
-                            }
-                        }
-
-                        valueNode->valueList.back() = trim(valueNode->valueList.back());
-                    }
-                }
+                splitList(*valueNode, line);
 
                 node->propertyValuePairs[toLower(key)] = std::move(valueNode);
                 return "";
@@ -351,7 +428,7 @@ namespace tgui
                     return "Found EOF while trying to read a value.";
                 else
                 {
-                    chr = stream.peek();
+                    const int chr = stream.peek();
                     if (chr == '=')
                         return "Found '=' while trying to read a value.";
                     else if (chr == '{')
@@ -364,7 +441,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName)
+        std::string parseSection(InputBuffer& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName)
         {
             // Create a new node for this section
             auto sectionNode = std::make_unique<DataIO::Node>();
@@ -372,8 +449,7 @@ namespace tgui
             sectionNode->name = sectionName;
 
             // Read the brace from the stream
-            char chr;
-            stream.read(&chr, 1);
+            stream.read();
 
             while (stream.peek() != EOF)
             {
@@ -388,18 +464,18 @@ namespace tgui
                     {
                         node->children.push_back(std::move(sectionNode));
 
-                        stream.read(&chr, 1);
+                        stream.read();
 
                         // Ignore semicolon behind closing brace
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
                         if (stream.peek() == ';')
-                            stream.read(&chr, 1);
+                            stream.read();
 
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
                         return "";
                     }
                     else if (stream.peek() != '{')
-                        return "Expected property or nested section name, found '" + std::string(1, stream.peek()) + "' instead.";
+                        return "Expected property or nested section name, found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
                 }
 
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
@@ -416,7 +492,7 @@ namespace tgui
                         return error;
                 }
                 else
-                    return "Expected '{' or '=', found '" + std::string(1, stream.peek()) + "' instead.";
+                    return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
             }
 
             return "Found EOF while reading section.";
@@ -424,7 +500,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseRootSection(std::stringstream& stream, std::unique_ptr<DataIO::Node>& root)
+        std::string parseRootSection(InputBuffer& stream, std::unique_ptr<DataIO::Node>& root)
         {
             REMOVE_WHITESPACE_AND_COMMENTS(false)
 
@@ -433,7 +509,7 @@ namespace tgui
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
                 if (stream.peek() != '{')
-                    return "Expected section name, found '" + std::string(1, stream.peek()) + "' instead.";
+                    return "Expected section name, found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
             }
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
@@ -442,42 +518,313 @@ namespace tgui
             else if (stream.peek() == '=')
                 return parseKeyValue(stream, root, word);
             else
-                return "Expected '{' or '=', found '" + std::string(1, stream.peek()) + "' instead.";
+                return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::vector<std::string> convertNodesToLines(const std::unique_ptr<DataIO::Node>& node)
+        // Layout of a binary widget file (all integers are stored as 32-bit little-endian values):
+        //   magic "TGBF", version
+        //   string count, for each string: length, bytes
+        //   root node
+        // where every node consists of:
+        //   name index, property count, for each property: key index, value index, list item count + 1 (0 if not a list),
+        //   the index of every list item, child count, the child nodes
+        const char binaryFormMagic[4] = {'T', 'G', 'B', 'F'};
+        const std::uint32_t binaryFormVersion = 2;
+
+        // Deeper trees are rejected, so that a corrupt or malicious file can't overflow the stack while it is being read
+        const std::size_t binaryFormMaxDepth = 256;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeUint32(std::string& buffer, std::uint32_t value)
         {
-            std::vector<std::string> output;
-            if (node->name.empty())
-                output.emplace_back("{");
-            else
-                output.emplace_back(node->name + " {");
+            buffer.push_back(static_cast<char>(value & 0xFF));
+            buffer.push_back(static_cast<char>((value >> 8) & 0xFF));
+            buffer.push_back(static_cast<char>((value >> 16) & 0xFF));
+            buffer.push_back(static_cast<char>((value >> 24) & 0xFF));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Strings are stored as UTF-8 so that values outside the ANSI range survive saving and loading
+        std::string toUtf8(const sf::String& str)
+        {
+            const auto utf8 = str.toUtf8();
+            return std::string(utf8.begin(), utf8.end());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::String fromUtf8(const std::string& str)
+        {
+            return sf::String::fromUtf8(str.begin(), str.end());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Removes the whitespace from a value in the same way as readLine does when the value is read from a text file
+        std::string normalizeValue(const std::string& value)
+        {
+            std::string line;
+            bool whitespaceFound = false;
+            std::size_t i = 0;
+            while (i < value.size())
+            {
+                const char c = value[i];
+                if (c == '"')
+                {
+                    const std::size_t quoteStart = i++;
+                    bool backslash = false;
+                    while (i < value.size())
+                    {
+                        const char quotedChar = value[i++];
+                        if (quotedChar == '"' && !backslash)
+                            break;
+
+                        backslash = (quotedChar == '\\' && !backslash);
+                    }
+
+                    line.append(value, quoteStart, i - quoteStart);
+                }
+                else if (::isspace(static_cast<unsigned char>(c)))
+                {
+                    i++;
+                    if (!whitespaceFound)
+                    {
+                        whitespaceFound = true;
+                        line.push_back(' ');
+                    }
+                }
+                else
+                {
+                    whitespaceFound = false;
+                    line.push_back(c);
+                    i++;
+                }
+            }
+
+            return trim(line);
+        }
 
-            if (!node->propertyValuePairs.empty())
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Writes the nodes while collecting the strings, each string is only stored once in the file
+        class BinaryFormWriter
+        {
+        public:
+            void writeNode(const std::unique_ptr<DataIO::Node>& node, bool rootNode = false, std::size_t depth = 0)
             {
+                if (depth >= binaryFormMaxDepth)
+                    throw Exception{"Failed to write binary widget file. Nodes are nested too deeply."};
+
+                // The properties are stored the way the parser would return them after reading the text form of the node,
+                // so that loading the binary file results in exactly the same tree as loading the text file.
+                std::map<std::string, Property> properties;
                 for (const auto& pair : node->propertyValuePairs)
-                    output.emplace_back("    " + pair.first + " = " + pair.second->value + ";");
+                {
+                    Property property;
+                    property.value = normalizeValue(toUtf8(pair.second->value));
+                    property.listNode = splitList(property.value, property.valueList);
+                    properties[toLower(pair.first)] = std::move(property);
+                }
+
+                // The name of the root node is never saved
+                writeUint32(m_nodes, addString(rootNode ? "" : node->name));
+                writeUint32(m_nodes, static_cast<std::uint32_t>(properties.size()));
+                for (const auto& pair : properties)
+                {
+                    writeUint32(m_nodes, addString(pair.first));
+                    writeUint32(m_nodes, addString(pair.second.value));
+                    if (pair.second.listNode)
+                    {
+                        writeUint32(m_nodes, static_cast<std::uint32_t>(pair.second.valueList.size() + 1));
+                        for (const auto& item : pair.second.valueList)
+                            writeUint32(m_nodes, addString(item));
+                    }
+                    else
+                        writeUint32(m_nodes, 0);
+                }
+
+                writeUint32(m_nodes, static_cast<std::uint32_t>(node->children.size()));
+                for (const auto& child : node->children)
+                    writeNode(child, false, depth + 1);
             }
 
-            if (node->propertyValuePairs.size() > 0 && node->children.size() > 0)
-                output.emplace_back("");
+            void write(std::ostream& stream) const
+            {
+                std::string header(binaryFormMagic, sizeof(binaryFormMagic));
+                writeUint32(header, binaryFormVersion);
+                writeUint32(header, static_cast<std::uint32_t>(m_stringIndices.size()));
+
+                stream.write(header.data(), static_cast<std::streamsize>(header.size()));
+                stream.write(m_strings.data(), static_cast<std::streamsize>(m_strings.size()));
+                stream.write(m_nodes.data(), static_cast<std::streamsize>(m_nodes.size()));
+            }
+
+        private:
+            std::uint32_t addString(const std::string& str)
+            {
+                const auto it = m_stringIndices.find(str);
+                if (it != m_stringIndices.end())
+                    return it->second;
+
+                const auto index = static_cast<std::uint32_t>(m_stringIndices.size());
+                m_stringIndices[str] = index;
+                writeUint32(m_strings, static_cast<std::uint32_t>(str.size()));
+                m_strings += str;
+                return index;
+            }
+
+        private:
+            // Value of a property in its UTF-8 form
+            struct Property
+            {
+                std::string value;
+                bool listNode = false;
+                std::vector<std::string> valueList;
+            };
+
+            std::map<std::string, std::uint32_t> m_stringIndices;
+            std::string m_strings;
+            std::string m_nodes;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Reads a binary widget file, every read is bounds checked so that a corrupt file results in an exception
+        class BinaryFormReader
+        {
+        public:
+            BinaryFormReader(const char* data, std::size_t size) :
+                m_data{data},
+                m_size{size}
+            {
+            }
 
-            if (!node->children.empty())
+            std::unique_ptr<DataIO::Node> read()
             {
-                for (std::size_t i = 0; i < node->children.size(); ++i)
+                const char* magic = readBytes(sizeof(binaryFormMagic));
+                if (std::string(magic, sizeof(binaryFormMagic)) != std::string(binaryFormMagic, sizeof(binaryFormMagic)))
+                    throw Exception{"Error while parsing binary widget file. Invalid header."};
+
+                const std::uint32_t version = readUint32();
+                if (version != binaryFormVersion)
+                    throw Exception{"Error while parsing binary widget file. Unsupported version " + std::to_string(version) + "."};
+
+                const std::uint32_t stringCount = readUint32();
+                for (std::uint32_t i = 0; i < stringCount; ++i)
                 {
-                    for (const auto& line : convertNodesToLines(node->children[i]))
-                        output.emplace_back("    " + line);
+                    const std::uint32_t length = readUint32();
+                    const char* str = readBytes(length);
+                    m_strings.emplace_back(str, length);
+                }
+
+                auto root = std::make_unique<DataIO::Node>();
+                readNode(*root, 0);
+
+                if (m_pos != m_size)
+                    throw Exception{"Error while parsing binary widget file. Unexpected data found after the root node."};
+
+                return root;
+            }
+
+        private:
+            void readNode(DataIO::Node& node, std::size_t depth)
+            {
+                if (depth >= binaryFormMaxDepth)
+                    throw Exception{"Error while parsing binary widget file. Nodes are nested too deeply."};
+
+                node.name = readString();
 
-                    if (i < node->children.size() - 1)
-                        output.emplace_back("");
+                const std::uint32_t propertyCount = readUint32();
+                for (std::uint32_t i = 0; i < propertyCount; ++i)
+                {
+                    const std::string& key = readString();
+                    auto valueNode = std::make_unique<DataIO::ValueNode>(fromUtf8(readString()));
+
+                    const std::uint32_t listSize = readUint32();
+                    if (listSize > 0)
+                    {
+                        valueNode->listNode = true;
+                        for (std::uint32_t j = 0; j < listSize - 1; ++j)
+                            valueNode->valueList.push_back(fromUtf8(readString()));
+                    }
+
+                    node.propertyValuePairs[key] = std::move(valueNode);
                 }
+
+                const std::uint32_t childCount = readUint32();
+                for (std::uint32_t i = 0; i < childCount; ++i)
+                {
+                    auto child = std::make_unique<DataIO::Node>();
+                    child->parent = &node;
+                    readNode(*child, depth + 1);
+                    node.children.push_back(std::move(child));
+                }
+            }
+
+            const std::string& readString()
+            {
+                const std::uint32_t index = readUint32();
+                if (index >= m_strings.size())
+                    throw Exception{"Error while parsing binary widget file. Invalid string index."};
+
+                return m_strings[index];
+            }
+
+            std::uint32_t readUint32()
+            {
+                const auto bytes = reinterpret_cast<const unsigned char*>(readBytes(4));
+                return static_cast<std::uint32_t>(bytes[0])
+                     | (static_cast<std::uint32_t>(bytes[1]) << 8)
+                     | (static_cast<std::uint32_t>(bytes[2]) << 16)
+                     | (static_cast<std::uint32_t>(bytes[3]) << 24);
+            }
+
+            const char* readBytes(std::size_t count)
+            {
+                if (count > m_size - m_pos)
+                    throw Exception{"Error while parsing binary widget file. Unexpected end of file."};
+
+                const char* bytes = m_data + m_pos;
+                m_pos += count;
+                return bytes;
             }
 
-            output.emplace_back("}");
-            return output;
+        private:
+            const char* m_data;
+            std::size_t m_size;
+            std::size_t m_pos = 0;
+            std::vector<std::string> m_strings;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void emitNode(const std::unique_ptr<DataIO::Node>& node, std::ostream& stream, std::size_t depth)
+        {
+            const std::string indentation(depth * 4, ' ');
+            if (node->name.empty())
+                stream << indentation << "{\n";
+            else
+                stream << indentation << node->name << " {\n";
+
+            for (const auto& pair : node->propertyValuePairs)
+                stream << indentation << "    " << pair.first << " = " << pair.second->value.toAnsiString() << ";\n";
+
+            if (node->propertyValuePairs.size() > 0 && node->children.size() > 0)
+                stream << indentation << '\n';
+
+            for (std::size_t i = 0; i < node->children.size(); ++i)
+            {
+                emitNode(node->children[i], stream, depth + 1);
+
+                if (i < node->children.size() - 1)
+                    stream << indentation << '\n';
+            }
+
+            stream << indentation << "}\n";
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -486,25 +833,30 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::unique_ptr<DataIO::Node> DataIO::parse(std::stringstream& stream)
+    {
+        // Parse the part of the stream that hasn't been read yet
+        const std::string str = stream.str();
+        std::size_t position = 0;
+        if (stream.tellg() != std::stringstream::pos_type(-1))
+            position = std::min(static_cast<std::size_t>(stream.tellg()), str.size());
+
+        auto root = parse(str.data() + position, str.size() - position);
+        stream.seekg(0, std::ios_base::end);
+        return root;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parse(const char* data, std::size_t size)
     {
         auto root = std::make_unique<Node>();
 
-        std::string error;
+        InputBuffer stream{data, size};
         while (stream.peek() != EOF)
         {
-            error = parseRootSection(stream, root);
+            const std::string error = parseRootSection(stream, root);
             if (!error.empty())
-            {
-                if (stream.tellg() != std::stringstream::pos_type(-1))
-                {
-                    std::string str = stream.str();
-                    auto position = static_cast<std::iterator_traits<std::string::const_iterator>::difference_type>(stream.tellg());
-                    std::size_t lineNumber = std::count(str.begin(), str.begin() + position, '\n') + 1;
-                    throw Exception{"Error while parsing input at line " + std::to_string(lineNumber) + ". " + error};
-                }
-                else
-                    throw Exception{"Error while parsing input. " + error};
-            }
+                throw Exception{"Error while parsing input at line " + std::to_string(stream.getLineNumber()) + ". " + error};
         }
 
         return root;
@@ -512,26 +864,44 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void DataIO::emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream)
+    void DataIO::emit(const std::unique_ptr<Node>& rootNode, std::ostream& stream)
     {
         for (const auto& pair : rootNode->propertyValuePairs)
-            stream << pair.first << " = " << pair.second->value.toAnsiString() << ";" << std::endl;
+            stream << pair.first << " = " << pair.second->value.toAnsiString() << ";\n";
 
         if (rootNode->propertyValuePairs.size() > 0 && rootNode->children.size() > 0)
-            stream << std::endl;
+            stream << '\n';
 
-        std::vector<std::string> output;
         for (std::size_t i = 0; i < rootNode->children.size(); ++i)
         {
-            for (const auto& line : convertNodesToLines(rootNode->children[i]))
-                output.emplace_back(std::move(line));
+            emitNode(rootNode->children[i], stream, 0);
 
             if (i < rootNode->children.size()-1)
-                output.emplace_back("");
+                stream << '\n';
         }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        for (const auto& line : output)
-            stream << line << std::endl;
+    std::unique_ptr<DataIO::Node> DataIO::parseBinary(const char* data, std::size_t size)
+    {
+        return BinaryFormReader{data, size}.read();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::emitBinary(const std::unique_ptr<Node>& rootNode, std::ostream& stream)
+    {
+        BinaryFormWriter writer;
+        writer.writeNode(rootNode, true);
+        writer.write(stream);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DataIO::isBinary(const char* data, std::size_t size)
+    {
+        return (size >= sizeof(binaryFormMagic)) && (std::string(data, sizeof(binaryFormMagic)) == std::string(binaryFormMagic, sizeof(binaryFormMagic)));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,9 +25,11 @@
 
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Loading/ResourcePack.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/Global.hpp>
 #include <cassert>
+#include <mutex>
 
 namespace tgui
 {
@@ -77,8 +79,22 @@ namespace tgui
             if (value == "null" || value == "nullptr")
                 return Font{};
 
+            const std::string filename = Deserializer::deserialize(ObjectConverter::Type::String, value).getString();
+
+            // The font reads from its memory while it is used, so the resource pack is kept alive until the font is destroyed
+            const char* packedData;
+            std::size_t packedSize;
+            if (const auto pack = ResourcePack::findMountedFile(filename, packedData, packedSize))
+            {
+                auto font = std::shared_ptr<sf::Font>(new sf::Font, [pack](sf::Font* packedFont){ delete packedFont; });
+                if (!font->loadFromMemory(packedData, packedSize))
+                    throw Exception{"Failed to load font '" + filename + "' from resource pack."};
+
+                return Font(font);
+            }
+
             auto font = std::make_shared<sf::Font>();
-            font->loadFromFile(Deserializer::deserialize(ObjectConverter::Type::String, value).getString());
+            font->loadFromFile(filename);
             return Font(font);
         }
 
@@ -459,10 +475,20 @@ namespace tgui
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::mutex cacheMutex;
+
+        // The cache of a type is emptied when it contains this many values
+        const std::size_t maxCachedValuesPerType = 1000;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::map<ObjectConverter::Type, std::unordered_map<std::string, ObjectConverter>> Deserializer::m_cache;
+    bool Deserializer::m_cacheEnabled = true;
+    std::size_t Deserializer::m_cacheHits = 0;
+    std::size_t Deserializer::m_cacheMisses = 0;
+
     std::map<ObjectConverter::Type, Deserializer::DeserializeFunc> Deserializer::m_deserializers =
         {
             {ObjectConverter::Type::Font, deserializeFont},
@@ -481,7 +507,33 @@ namespace tgui
     ObjectConverter Deserializer::deserialize(ObjectConverter::Type type, const std::string& serializedString)
     {
         assert(m_deserializers.find(type) != m_deserializers.end());
-        return m_deserializers[type](serializedString);
+        if (!m_cacheEnabled || !isCacheable(type))
+            return m_deserializers.at(type)(serializedString);
+
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            const auto& typeCache = m_cache[type];
+            const auto it = typeCache.find(serializedString);
+            if (it != typeCache.end())
+            {
+                ++m_cacheHits;
+                return it->second;
+            }
+        }
+
+        // The lock is not held while deserializing, the deserialize function may recursively deserialize other values.
+        // Values that fail to deserialize throw an exception and are thus never cached.
+        ObjectConverter value = m_deserializers.at(type)(serializedString);
+
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        ++m_cacheMisses;
+
+        auto& typeCache = m_cache[type];
+        if (typeCache.size() >= maxCachedValuesPerType)
+            typeCache.clear();
+
+        typeCache.emplace(serializedString, value);
+        return value;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -489,6 +541,9 @@ namespace tgui
     void Deserializer::setFunction(ObjectConverter::Type type, const DeserializeFunc& deserializer)
     {
         m_deserializers[type] = deserializer;
+
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        m_cache.erase(type);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -500,6 +555,75 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Deserializer::setCacheEnabled(bool enabled)
+    {
+        m_cacheEnabled = enabled;
+        if (!enabled)
+            clearCache();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Deserializer::isCacheEnabled()
+    {
+        return m_cacheEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Deserializer::clearCache()
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        m_cache.clear();
+        m_cacheHits = 0;
+        m_cacheMisses = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Deserializer::clearCache(ObjectConverter::Type type)
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        m_cache.erase(type);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Deserializer::getCacheHits()
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        return m_cacheHits;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Deserializer::getCacheMisses()
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        return m_cacheMisses;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Deserializer::isCacheable(ObjectConverter::Type type)
+    {
+        switch (type)
+        {
+            case ObjectConverter::Type::Font:
+            case ObjectConverter::Type::Color:
+            case ObjectConverter::Type::String:
+            case ObjectConverter::Type::Number:
+            case ObjectConverter::Type::Layout:
+            case ObjectConverter::Type::Outline:
+            case ObjectConverter::Type::TextStyle:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::vector<std::string> Deserializer::split(const std::string& str, char delim)
     {
         std::vector<std::string> tokens;
@@ -0,0 +1,429 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Loading/ResourcePack.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Exception.hpp>
+#include <TGUI/Global.hpp>
+#include <TGUI/to_string.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+
+#ifdef SFML_SYSTEM_WINDOWS
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Layout of the file (all integers are stored as 32-bit little-endian values):
+        //   magic "TGRP", version
+        //   file count, for each file: name length, UTF-8 name, offset of the contents from the start of the pack, size
+        //   the contents of all files
+        const char resourcePackMagic[4] = {'T', 'G', 'R', 'P'};
+        const std::uint32_t resourcePackVersion = 1;
+
+        // Protects the list of mounted packs, files are looked up from the threads that preload themes
+        std::mutex mountedPacksMutex;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeUint32(std::string& buffer, std::uint32_t value)
+        {
+            buffer.push_back(static_cast<char>(value & 0xFF));
+            buffer.push_back(static_cast<char>((value >> 8) & 0xFF));
+            buffer.push_back(static_cast<char>((value >> 16) & 0xFF));
+            buffer.push_back(static_cast<char>((value >> 24) & 0xFF));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint32_t readUint32(const char* data, std::size_t size, std::size_t& pos, const std::string& filename)
+        {
+            if (size - pos < 4)
+                throw Exception{"Unexpected end of resource pack '" + filename + "'."};
+
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data + pos);
+            pos += 4;
+            return static_cast<std::uint32_t>(bytes[0])
+                 | (static_cast<std::uint32_t>(bytes[1]) << 8)
+                 | (static_cast<std::uint32_t>(bytes[2]) << 16)
+                 | (static_cast<std::uint32_t>(bytes[3]) << 24);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Turns backslashes into slashes and removes "." and ".." parts, so that different spellings of a path match
+        std::string normalizePath(const std::string& path)
+        {
+            std::string normalized = path;
+            std::replace(normalized.begin(), normalized.end(), '\\', '/');
+
+            const bool absolute = !normalized.empty() && (normalized[0] == '/');
+
+            std::vector<std::string> parts;
+            std::size_t start = 0;
+            while (start <= normalized.size())
+            {
+                std::size_t end = normalized.find('/', start);
+                if (end == std::string::npos)
+                    end = normalized.size();
+
+                const std::string part = normalized.substr(start, end - start);
+                if ((part == "..") && !parts.empty() && (parts.back() != ".."))
+                    parts.pop_back();
+                else if (!part.empty() && (part != "."))
+                    parts.push_back(part);
+
+                start = end + 1;
+            }
+
+            std::string result = absolute ? "/" : "";
+            for (std::size_t i = 0; i < parts.size(); ++i)
+            {
+                if (i > 0)
+                    result += '/';
+                result += parts[i];
+            }
+
+            return result;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::pair<std::string, ResourcePack::ConstPtr>> ResourcePack::m_mountedPacks;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ResourcePack::ResourcePack(const std::string& filename)
+    {
+        const std::string fullFilename = getResourcePath() + filename;
+
+    #ifdef SFML_SYSTEM_WINDOWS
+        HANDLE fileHandle = CreateFileA(fullFilename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+            throw Exception{"Failed to open resource pack '" + fullFilename + "'."};
+
+        m_fileHandle = fileHandle;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize))
+        {
+            unmap();
+            throw Exception{"Failed to open resource pack '" + fullFilename + "'."};
+        }
+
+        m_size = static_cast<std::size_t>(fileSize.QuadPart);
+        if (m_size > 0)
+        {
+            m_mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (m_mappingHandle)
+                m_data = static_cast<const char*>(MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+
+            if (!m_data)
+            {
+                unmap();
+                throw Exception{"Failed to map resource pack '" + fullFilename + "' in memory."};
+            }
+        }
+    #else
+        const int fileDescriptor = open(fullFilename.c_str(), O_RDONLY);
+        if (fileDescriptor < 0)
+            throw Exception{"Failed to open resource pack '" + fullFilename + "'."};
+
+        struct stat fileInfo;
+        if (fstat(fileDescriptor, &fileInfo) != 0)
+        {
+            close(fileDescriptor);
+            throw Exception{"Failed to open resource pack '" + fullFilename + "'."};
+        }
+
+        m_size = static_cast<std::size_t>(fileInfo.st_size);
+        if (m_size > 0)
+        {
+            void* mapping = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+            if (mapping == MAP_FAILED)
+            {
+                close(fileDescriptor);
+                throw Exception{"Failed to map resource pack '" + fullFilename + "' in memory."};
+            }
+
+            m_data = static_cast<const char*>(mapping);
+        }
+
+        // The mapping remains valid after the file is closed
+        close(fileDescriptor);
+    #endif
+
+        // Read the index and validate it, so that the offsets no longer have to be checked when accessing the files
+        try
+        {
+            std::size_t pos = 0;
+            if ((m_size < sizeof(resourcePackMagic)) || !std::equal(resourcePackMagic, resourcePackMagic + sizeof(resourcePackMagic), m_data))
+                throw Exception{"File '" + filename + "' is not a resource pack."};
+
+            pos += sizeof(resourcePackMagic);
+            const std::uint32_t version = readUint32(m_data, m_size, pos, filename);
+            if (version != resourcePackVersion)
+                throw Exception{"Resource pack '" + filename + "' has unsupported version " + to_string(version) + "."};
+
+            const std::uint32_t fileCount = readUint32(m_data, m_size, pos, filename);
+            for (std::uint32_t i = 0; i < fileCount; ++i)
+            {
+                const std::uint32_t nameLength = readUint32(m_data, m_size, pos, filename);
+                if (nameLength > m_size - pos)
+                    throw Exception{"Unexpected end of resource pack '" + filename + "'."};
+
+                std::string name(m_data + pos, nameLength);
+                pos += nameLength;
+
+                const std::uint32_t offset = readUint32(m_data, m_size, pos, filename);
+                const std::uint32_t size = readUint32(m_data, m_size, pos, filename);
+                if ((offset > m_size) || (size > m_size - offset))
+                    throw Exception{"Resource pack '" + filename + "' is corrupt."};
+
+                m_index[name] = {offset, size};
+                m_filenames.push_back(std::move(name));
+            }
+        }
+        catch (...)
+        {
+            unmap();
+            throw;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ResourcePack::~ResourcePack()
+    {
+        unmap();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const char* ResourcePack::getFile(const std::string& filename, std::size_t& size) const
+    {
+        const auto it = m_index.find(normalizePath(filename));
+        if (it == m_index.end())
+            return nullptr;
+
+        size = it->second.second;
+        return m_data + it->second.first;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ResourcePack::contains(const std::string& filename) const
+    {
+        return m_index.find(normalizePath(filename)) != m_index.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::string> ResourcePack::getFilenames() const
+    {
+        return m_filenames;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ResourcePack::create(const std::string& outputFilename, const std::vector<std::string>& filenames)
+    {
+        std::vector<std::string> names;
+        std::vector<std::string> contents;
+        for (const auto& filename : filenames)
+        {
+            std::ifstream file{getResourcePath() + filename, std::ios::binary};
+            if (!file.is_open())
+                throw Exception{"Failed to open '" + getResourcePath() + filename + "' to add it to the resource pack."};
+
+            std::string name = normalizePath(filename);
+            if (std::find(names.begin(), names.end(), name) != names.end())
+                continue;
+
+            names.push_back(std::move(name));
+            contents.emplace_back(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+        }
+
+        // The contents are stored after the index, so the size of the index has to be known before the offsets can be written
+        std::size_t offset = sizeof(resourcePackMagic) + 8;
+        for (const auto& name : names)
+            offset += 12 + name.size();
+
+        std::string index{resourcePackMagic, sizeof(resourcePackMagic)};
+        writeUint32(index, resourcePackVersion);
+        writeUint32(index, static_cast<std::uint32_t>(names.size()));
+        for (std::size_t i = 0; i < names.size(); ++i)
+        {
+            if (offset + contents[i].size() > 0xFFFFFFFF)
+                throw Exception{"Failed to create resource pack '" + getResourcePath() + outputFilename + "', the files are too large."};
+
+            writeUint32(index, static_cast<std::uint32_t>(names[i].size()));
+            index += names[i];
+            writeUint32(index, static_cast<std::uint32_t>(offset));
+            writeUint32(index, static_cast<std::uint32_t>(contents[i].size()));
+            offset += contents[i].size();
+        }
+
+        std::ofstream file{getResourcePath() + outputFilename, std::ios::binary};
+        if (!file.is_open())
+            throw Exception{"Failed to open '" + getResourcePath() + outputFilename + "' for writing."};
+
+        file.write(index.data(), static_cast<std::streamsize>(index.size()));
+        for (const auto& content : contents)
+            file.write(content.data(), static_cast<std::streamsize>(content.size()));
+
+        if (!file)
+            throw Exception{"Failed to write resource pack '" + getResourcePath() + outputFilename + "'."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ResourcePack::mount(const ConstPtr& pack, const std::string& mountPoint)
+    {
+        std::string normalizedMountPoint = normalizePath(mountPoint);
+        if (!normalizedMountPoint.empty() && (normalizedMountPoint.back() != '/'))
+            normalizedMountPoint.push_back('/');
+
+        {
+            std::lock_guard<std::mutex> lock(mountedPacksMutex);
+            m_mountedPacks.emplace_back(normalizedMountPoint, pack);
+        }
+
+        // Cached fonts may have been loaded from a file that the new pack now replaces
+        Deserializer::clearCache(ObjectConverter::Type::Font);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ResourcePack::unmount(const ConstPtr& pack)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mountedPacksMutex);
+            m_mountedPacks.erase(std::remove_if(m_mountedPacks.begin(), m_mountedPacks.end(),
+                                                [&](const std::pair<std::string, ConstPtr>& mounted){ return mounted.second == pack; }),
+                                 m_mountedPacks.end());
+        }
+
+        // Fonts loaded from the pack keep it alive, they are no longer shared with widgets that are loaded later
+        Deserializer::clearCache(ObjectConverter::Type::Font);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ResourcePack::unmountAll()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mountedPacksMutex);
+            m_mountedPacks.clear();
+        }
+
+        Deserializer::clearCache(ObjectConverter::Type::Font);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ResourcePack::ConstPtr ResourcePack::findMountedFile(const std::string& filename, const char*& data, std::size_t& size)
+    {
+        std::lock_guard<std::mutex> lock(mountedPacksMutex);
+
+        // Don't pay for normalizing the path when no packs are being used
+        if (m_mountedPacks.empty())
+            return nullptr;
+
+        // Files are looked up by their name relative to the resource path, so the resource path is removed from full filenames
+        std::string normalizedFilename = normalizePath(filename);
+        std::string resourcePath = normalizePath(getResourcePath());
+        if (!resourcePath.empty())
+        {
+            if (resourcePath.back() != '/')
+                resourcePath.push_back('/');
+
+            if (normalizedFilename.compare(0, resourcePath.size(), resourcePath) == 0)
+                normalizedFilename.erase(0, resourcePath.size());
+        }
+
+        for (auto it = m_mountedPacks.rbegin(); it != m_mountedPacks.rend(); ++it)
+        {
+            const std::string& mountPoint = it->first;
+            if (normalizedFilename.compare(0, mountPoint.size(), mountPoint) != 0)
+                continue;
+
+            const auto fileIt = it->second->m_index.find(normalizedFilename.substr(mountPoint.size()));
+            if (fileIt != it->second->m_index.end())
+            {
+                data = it->second->m_data + fileIt->second.first;
+                size = fileIt->second.second;
+                return it->second;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ResourcePack::unmap()
+    {
+    #ifdef SFML_SYSTEM_WINDOWS
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mappingHandle)
+            CloseHandle(m_mappingHandle);
+        if (m_fileHandle)
+            CloseHandle(m_fileHandle);
+
+        m_mappingHandle = nullptr;
+        m_fileHandle = nullptr;
+    #else
+        if (m_data)
+            munmap(const_cast<char*>(m_data), m_size);
+    #endif
+
+        m_data = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
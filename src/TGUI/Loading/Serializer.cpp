@@ -29,6 +29,9 @@
 #include <TGUI/Exception.hpp>
 #include <TGUI/to_string.hpp>
 #include <cassert>
+#include <clocale>
+#include <cstdio>
+#include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -41,28 +44,44 @@ namespace tgui
         char decToSingleHex(unsigned char c)
         {
             assert(c < 16);
+            return "0123456789ABCDEF"[c];
+        }
 
-            if (c == 10)
-                return 'A';
-            else if (c == 11)
-                return 'B';
-            else if (c == 12)
-                return 'C';
-            else if (c == 13)
-                return 'D';
-            else if (c == 14)
-                return 'E';
-            else if (c == 15)
-                return 'F';
-            else
-                return static_cast<char>(c + '0');
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds the two hexadecimal digits of the value to the buffer and returns the position behind them
+        char* writeHex(char* buffer, unsigned char c)
+        {
+            buffer[0] = decToSingleHex(c / 16);
+            buffer[1] = decToSingleHex(c % 16);
+            return buffer + 2;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string decToHex(unsigned char c)
+        // Formats the number in the same way as writing it to an std::ostream with the classic locale, but without creating a stream
+        std::string formatNumber(float value)
         {
-            return {decToSingleHex(c / 16), decToSingleHex(c % 16)};
+            // Most numbers in widget files are integers, these can be converted directly.
+            // Only numbers below 1e6 are written without exponent, negative zero is written as "-0".
+            if ((value == std::trunc(value)) && (std::abs(value) < 1e6f) && !((value == 0) && std::signbit(value)))
+                return std::to_string(static_cast<int>(value));
+
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%g", static_cast<double>(value));
+
+            // The decimal separator depends on the C locale while the file format always uses a dot
+            const char decimalPoint = std::localeconv()->decimal_point[0];
+            if (decimalPoint != '.')
+            {
+                for (char* c = buffer; *c != '\0'; ++c)
+                {
+                    if (*c == decimalPoint)
+                        *c = '.';
+                }
+            }
+
+            return buffer;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -86,7 +105,7 @@ namespace tgui
 
         std::string serializeColor(ObjectConverter&& value)
         {
-            static std::map<std::string, sf::Color> colorMap =
+            static const std::pair<const char*, sf::Color> colorNames[] =
             {
                 {"Black", sf::Color::Black},
                 {"White", sf::Color::White},
@@ -99,17 +118,22 @@ namespace tgui
                 {"Transparent", sf::Color::Transparent}
             };
 
-            sf::Color color = value.getColor();
+            const sf::Color color = value.getColor();
 
             // Check if the color can be represented by a string with its name
-            for (const auto& pair : colorMap)
+            for (const auto& pair : colorNames)
             {
                 if (color == pair.second)
                     return pair.first;
             }
 
             // Return the color by its rgb value
-            return "#" + decToHex(color.r) + decToHex(color.g) + decToHex(color.b) + (color.a < 255 ? decToHex(color.a) : "");
+            char buffer[9] = {'#'};
+            char* end = writeHex(writeHex(writeHex(buffer + 1, color.r), color.g), color.b);
+            if (color.a < 255)
+                end = writeHex(end, color.a);
+
+            return {buffer, end};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -143,7 +167,7 @@ namespace tgui
 
         std::string serializeNumber(ObjectConverter&& value)
         {
-            return to_string(value.getNumber());
+            return formatNumber(value.getNumber());
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
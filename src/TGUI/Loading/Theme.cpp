@@ -25,8 +25,16 @@
 
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/TextureManager.hpp>
 #include <TGUI/Global.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -37,6 +45,98 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        bool isSameValue(ObjectConverter& oldValue, ObjectConverter& newValue)
+        {
+            // Nested renderers are compared property by property, to avoid serializing them
+            if ((oldValue.getType() == ObjectConverter::Type::RendererData) && (newValue.getType() == ObjectConverter::Type::RendererData))
+            {
+                auto& oldProperties = oldValue.getRenderer()->propertyValuePairs;
+                auto& newProperties = newValue.getRenderer()->propertyValuePairs;
+                if (oldProperties.size() != newProperties.size())
+                    return false;
+
+                for (auto& property : newProperties)
+                {
+                    const auto oldIt = oldProperties.find(property.first);
+                    if ((oldIt == oldProperties.end()) || !isSameValue(oldIt->second, property.second))
+                        return false;
+                }
+
+                return true;
+            }
+
+            return oldValue.getString() == newValue.getString();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::map<std::string, ObjectConverter> copyRendererProperties(const std::map<std::string, ObjectConverter>& properties)
+        {
+            // The data of the theme loader is shared, nested renderers are copied so that changing them won't affect the loader
+            auto result = properties;
+            for (auto& pair : result)
+            {
+                if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                    pair.second = {RendererData::create(copyRendererProperties(pair.second.getRenderer()->propertyValuePairs))};
+            }
+
+            return result;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Extracts the filename from a serialized texture without loading it, the same way as the texture deserializer does
+        std::string getTextureFilename(const std::string& value)
+        {
+            const std::string texture = trim(value);
+            if (texture.empty() || (toLower(texture) == "none"))
+                return "";
+
+            if (texture[0] != '"')
+                return getResourcePath() + texture;
+
+            std::string filename;
+            char prev = '\0';
+            for (auto c = texture.begin() + 1; c != texture.end(); ++c)
+            {
+                if ((*c == '"') && (prev != '\\'))
+                    return getResourcePath() + filename;
+
+                filename.push_back(*c);
+                prev = *c;
+            }
+
+            return ""; // The end quote is missing
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void findResources(const std::map<std::string, ObjectConverter>& properties, std::vector<std::string>& textures, std::vector<std::string>& fonts)
+        {
+            // The properties are shared with the theme loader, so they are only read through copies of the values
+            for (const auto& property : properties)
+            {
+                if (property.second.getType() == ObjectConverter::Type::RendererData)
+                    findResources(ObjectConverter{property.second}.getRenderer()->propertyValuePairs, textures, fonts);
+                else if (property.second.getType() == ObjectConverter::Type::String)
+                {
+                    if ((property.first.size() >= 7) && (property.first.compare(0, 7, "texture") == 0))
+                    {
+                        const std::string filename = getTextureFilename(ObjectConverter{property.second}.getString());
+                        if (!filename.empty())
+                            textures.push_back(filename);
+                    }
+                    else if (property.first == "font")
+                        fonts.push_back(ObjectConverter{property.second}.getString());
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Theme::Theme(const std::string& primary) :
         m_primary(primary)
     {
@@ -50,21 +150,21 @@ namespace tgui
     {
         m_primary = primary;
         m_themeLoader->preload(primary);
+        m_changedPropertyCount = 0;
 
         // Update the existing renderers
         for (auto& pair : m_renderers)
         {
             auto& renderer = pair.second;
-            auto oldData = renderer;
 
             /// TODO: Exceptions should not be used for such situations!
             ///       Add a function to ThemeLoader that lists which sections exist.
 
             // Try to load the new renderer
-            const std::map<sf::String, sf::String>* properties;
+            std::map<std::string, ObjectConverter> properties;
             try
             {
-                properties = &m_themeLoader->load(m_primary, pair.first);
+                properties = copyRendererProperties(m_themeLoader->loadRenderer(m_primary, pair.first)->propertyValuePairs);
             }
             catch (const Exception&)
             {
@@ -73,67 +173,50 @@ namespace tgui
                 continue;
             }
 
-            // Keep track of the old font
-            Font oldFont;
-            if (renderer->propertyValuePairs.find("font") != pair.second->propertyValuePairs.end())
-                oldFont = renderer->propertyValuePairs["font"].getFont();
-
-            // Update the property-value pairs of the renderer
-            renderer->propertyValuePairs = std::map<std::string, ObjectConverter>{};
-            for (const auto& property : *properties)
-                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
-            // If there used to be a font but no new font was set then keep the old font
-            if ((properties->find("font") == properties->end()) && (oldFont != nullptr))
-                renderer->propertyValuePairs["font"] = ObjectConverter(oldFont);
-
-            // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value
-            auto oldIt = oldData->propertyValuePairs.begin();
-            auto newIt = renderer->propertyValuePairs.begin();
-            while (oldIt != oldData->propertyValuePairs.end() && newIt != renderer->propertyValuePairs.end())
+            std::set<std::string> changedProperties;
+            std::map<std::string, ObjectConverter> newPropertyValuePairs;
+            for (auto& property : properties)
             {
-                if (oldIt->first < newIt->first)
-                {
-                    // Update values that no longer exist in the new renderer and are now reset to the default value
-                    for (const auto& observer : renderer->observers)
-                        observer.second(oldIt->first);
-
-                    ++oldIt;
-                }
+                // Values that didn't change are kept as they are, so that they don't have to be deserialized again
+                const auto oldIt = renderer->propertyValuePairs.find(property.first);
+                if ((oldIt != renderer->propertyValuePairs.end()) && isSameValue(oldIt->second, property.second))
+                    newPropertyValuePairs[property.first] = std::move(oldIt->second);
                 else
                 {
-                    // Update changed and new properties
-                    for (const auto& observer : renderer->observers)
-                        observer.second(newIt->first);
-
-                    if (newIt->first < oldIt->first)
-                        ++newIt;
-                    else
-                    {
-                        ++oldIt;
-                        ++newIt;
-                    }
+                    newPropertyValuePairs[property.first] = std::move(property.second);
+                    changedProperties.insert(property.first);
                 }
             }
-            while (oldIt != oldData->propertyValuePairs.end())
-            {
-                for (const auto& observer : renderer->observers)
-                    observer.second(oldIt->first);
 
-                ++oldIt;
-            }
-            while (newIt != renderer->propertyValuePairs.end())
+            for (auto& property : renderer->propertyValuePairs)
             {
-                for (const auto& observer : renderer->observers)
-                    observer.second(newIt->first);
-
-                ++newIt;
+                if (newPropertyValuePairs.find(property.first) != newPropertyValuePairs.end())
+                    continue;
+
+                // If there used to be a font but no new font was set then keep the old font
+                if ((property.first == "font") && (property.second.getFont() != nullptr))
+                    newPropertyValuePairs["font"] = std::move(property.second);
+                else // The property no longer exists and has to be reset to its default value
+                    changedProperties.insert(property.first);
             }
+
+            // Tell the widgets that were using this renderer about the properties that were added, changed or removed
+            renderer->propertyValuePairs = std::move(newPropertyValuePairs);
+            renderer->notifyObservers(changedProperties);
+
+            m_changedPropertyCount += changedProperties.size();
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t Theme::getChangedPropertyCount() const
+    {
+        return m_changedPropertyCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::shared_ptr<RendererData> Theme::getRenderer(const std::string& id)
     {
         std::string lowercaseSecondary = toLower(id);
@@ -143,11 +226,8 @@ namespace tgui
         if (it != m_renderers.end())
             return it->second;
 
-        m_renderers[lowercaseSecondary] = RendererData::create();
-        auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
-        for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
+        // The widgets using the theme share its own copy of the renderer, so that they can be updated when the theme is reloaded
+        m_renderers[lowercaseSecondary] = RendererData::create(copyRendererProperties(m_themeLoader->loadRenderer(m_primary, lowercaseSecondary)->propertyValuePairs));
         return m_renderers[lowercaseSecondary];
     }
 
@@ -187,6 +267,84 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::future<void> Theme::preloadAsync(const std::string& primary)
+    {
+        const auto themeLoader = m_themeLoader;
+        return std::async(std::launch::async, [themeLoader, primary]
+        {
+            themeLoader->preload(primary);
+
+            std::vector<std::string> textures;
+            std::vector<std::string> fonts;
+            for (const auto& section : themeLoader->getSectionNames(primary))
+            {
+                findResources(themeLoader->loadRenderer(primary, section)->propertyValuePairs, textures, fonts);
+            }
+
+            std::sort(textures.begin(), textures.end());
+            textures.erase(std::unique(textures.begin(), textures.end()), textures.end());
+
+            // The first exception that is thrown on one of the threads is passed to the caller through the returned future
+            std::mutex errorMutex;
+            std::exception_ptr error;
+            const auto storeError = [&errorMutex, &error]
+            {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error)
+                    error = std::current_exception();
+            };
+
+            // Decode the images on a pool of threads, the textures are created on the gui thread when the renderers are used.
+            // Images that can't be found are skipped, loading them again when they are used will report the error.
+            std::atomic<std::size_t> nextTexture{0};
+            const auto decodeImages = [&textures, &nextTexture, &storeError]
+            {
+                std::size_t index;
+                while ((index = nextTexture++) < textures.size())
+                {
+                    try
+                    {
+                        TextureManager::preloadImage(textures[index]);
+                    }
+                    catch (...)
+                    {
+                        storeError();
+                    }
+                }
+            };
+
+            const std::size_t threadCount = std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), textures.size());
+            std::vector<std::thread> workers;
+            for (std::size_t i = 1; i < threadCount; ++i)
+                workers.emplace_back(decodeImages);
+
+            // Fonts are loaded in the deserializer cache while the workers decode the images
+            if (Deserializer::isCacheEnabled())
+            {
+                for (const auto& font : fonts)
+                {
+                    try
+                    {
+                        Deserializer::deserialize(ObjectConverter::Type::Font, font);
+                    }
+                    catch (...)
+                    {
+                        storeError();
+                    }
+                }
+            }
+
+            decodeImages();
+            for (auto& worker : workers)
+                worker.join();
+
+            if (error)
+                std::rethrow_exception(error);
+        });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,13 +24,16 @@
 
 
 #include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Loading/ResourcePack.hpp>
 #include <TGUI/Global.hpp>
 
 #include <cassert>
 #include <sstream>
 #include <fstream>
+#include <mutex>
 #include <set>
 
 #ifdef SFML_SYSTEM_ANDROID
@@ -52,12 +55,22 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> DefaultThemeLoader::m_propertiesCache;
+    std::map<std::string, std::map<std::string, const std::map<sf::String, sf::String>*>> DefaultThemeLoader::m_propertiesCache;
+    std::map<std::string, std::map<std::string, std::shared_ptr<RendererData>>> DefaultThemeLoader::m_renderersCache;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     namespace
     {
+        // Protects the caches, which are filled when a theme is preloaded on another thread
+        std::mutex cacheMutex;
+
+        // The properties that were returned by load. They are never removed, as callers may still be using them after the
+        // cache is flushed. Identical sections share their properties, so reloading a file only adds the sections that changed.
+        std::set<std::map<sf::String, sf::String>> loadedProperties;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         void injectRelativePathInTextures(std::set<const DataIO::Node*>& handledSections, const std::unique_ptr<DataIO::Node>& node, const std::string& path)
         {
             for (const auto& pair : node->propertyValuePairs)
@@ -86,8 +99,17 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void resolveReferences(std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>>& sections, const std::unique_ptr<DataIO::Node>& node)
+        std::shared_ptr<RendererData> createRendererData(const std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>>& sections,
+                                                         std::map<const DataIO::Node*, std::shared_ptr<RendererData>>& createdRenderers,
+                                                         const std::unique_ptr<DataIO::Node>& node)
         {
+            // Sections that are referenced multiple times are only converted once
+            auto createdIt = createdRenderers.find(node.get());
+            if (createdIt != createdRenderers.end())
+                return createdIt->second;
+
+            // The renderers are shared by everyone loading them, they are copied before they get changed
+            auto rendererData = RendererData::createCopyOnWrite({});
             for (const auto& pair : node->propertyValuePairs)
             {
                 // Check if this property is a reference to another section
@@ -99,18 +121,34 @@ namespace tgui
                     if (sectionsIt == sections.end())
                         throw Exception{"Undefined reference to '" + name + "' encountered."};
 
-                    // Resolve references recursively
-                    resolveReferences(sections, sectionsIt->second);
-
-                    // Make a copy of the section
-                    std::stringstream ss;
-                    DataIO::emit(sectionsIt->second, ss);
-                    pair.second->value = "{\n" + ss.str() + "}";
+                    rendererData->propertyValuePairs[toLower(pair.first)] = {createRendererData(sections, createdRenderers, sectionsIt->second)};
                 }
+                else
+                    rendererData->propertyValuePairs[toLower(pair.first)] = {pair.second->value};
             }
 
             for (const auto& child : node->children)
-                resolveReferences(sections, child);
+                rendererData->propertyValuePairs[toLower(child->name)] = {createRendererData(sections, createdRenderers, child)};
+
+            createdRenderers[node.get()] = rendererData;
+            return rendererData;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::map<sf::String, sf::String> convertToStrings(const RendererData& rendererData)
+        {
+            // Nested renderers are returned in text form, as they would be written inside the theme file
+            std::map<sf::String, sf::String> properties;
+            for (const auto& pair : rendererData.propertyValuePairs)
+            {
+                if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                    properties[pair.first] = "{\n" + Serializer::serialize(ObjectConverter{pair.second}) + "}";
+                else
+                    properties[pair.first] = ObjectConverter{pair.second}.getString();
+            }
+
+            return properties;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -124,17 +162,39 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::shared_ptr<RendererData> BaseThemeLoader::loadRenderer(const std::string& primary, const std::string& secondary)
+    {
+        auto rendererData = RendererData::createCopyOnWrite({});
+        for (const auto& property : load(primary, secondary))
+            rendererData->propertyValuePairs[property.first] = ObjectConverter(property.second);
+
+        return rendererData;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::string> BaseThemeLoader::getSectionNames(const std::string&)
+    {
+        return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DefaultThemeLoader::flushCache(const std::string& filename)
     {
+        std::lock_guard<std::mutex> lock(cacheMutex);
         if (filename != "")
         {
             auto propertiesCacheIt = m_propertiesCache.find(filename);
             if (propertiesCacheIt != m_propertiesCache.end())
                 m_propertiesCache.erase(propertiesCacheIt);
+
+            m_renderersCache.erase(filename);
         }
         else
         {
             m_propertiesCache.clear();
+            m_renderersCache.clear();
         }
     }
 
@@ -145,74 +205,146 @@ namespace tgui
         if (filename == "")
             return;
 
-        // Load the file when not already in cache
-        if (m_propertiesCache.find(filename) == m_propertiesCache.end())
         {
-            std::string resourcePath;
-            auto slashPos = filename.find_last_of("/\\");
-            if (slashPos != std::string::npos)
-                resourcePath = filename.substr(0, slashPos+1);
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            if (m_renderersCache.find(filename) != m_renderersCache.end())
+                return;
+        }
 
-            std::stringstream fileContents;
-            readFile(filename, fileContents);
+        // Load the file when not already in cache. The lock isn't held while parsing, so that other files can still be used.
+        std::string resourcePath;
+        auto slashPos = filename.find_last_of("/\\");
+        if (slashPos != std::string::npos)
+            resourcePath = filename.substr(0, slashPos+1);
 
-            std::unique_ptr<DataIO::Node> root = DataIO::parse(fileContents);
+        std::stringstream fileContents;
+        readFile(filename, fileContents);
 
-            if (root->propertyValuePairs.size() != 0)
-                throw Exception{"Unexpected result while loading theme file '" + filename + "'. Root property-value pair found."};
+        std::unique_ptr<DataIO::Node> root = DataIO::parse(fileContents);
 
-            // Inject relative path to the theme file into texture filenames
-            if (!resourcePath.empty())
-            {
-                std::set<const DataIO::Node*> handledSections;
-                injectRelativePathInTextures(handledSections, root, resourcePath);
-            }
+        if (root->propertyValuePairs.size() != 0)
+            throw Exception{"Unexpected result while loading theme file '" + filename + "'. Root property-value pair found."};
 
-            // Get a list of section names and map them to their nodes (needed for resolving references)
-            std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>> sections;
-            for (const auto& child : root->children)
-            {
-                std::string name = toLower(Deserializer::deserialize(ObjectConverter::Type::String, child->name).getString());
-                sections.emplace(name, std::cref(child));
-            }
+        // Inject relative path to the theme file into texture filenames
+        if (!resourcePath.empty())
+        {
+            std::set<const DataIO::Node*> handledSections;
+            injectRelativePathInTextures(handledSections, root, resourcePath);
+        }
 
-            // Resolve references to sections
-            resolveReferences(sections, root);
+        // Get a list of section names and map them to their nodes (needed for resolving references)
+        std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>> sections;
+        for (const auto& child : root->children)
+        {
+            std::string name = toLower(Deserializer::deserialize(ObjectConverter::Type::String, child->name).getString());
+            sections.emplace(name, std::cref(child));
+        }
 
-            // Cache all propery value pairs
-            for (const auto& section : sections)
-            {
-                const auto& child = section.second;
-                const std::string& name = section.first;
-                for (const auto& pair : child.get()->propertyValuePairs)
-                    m_propertiesCache[filename][name][toLower(pair.first)] = pair.second->value;
+        // Convert the sections to renderer data. References to other sections share the renderer data of that section.
+        std::map<const DataIO::Node*, std::shared_ptr<RendererData>> createdRenderers;
+        std::map<std::string, std::shared_ptr<RendererData>> renderers;
+        for (const auto& section : sections)
+            renderers[section.first] = createRendererData(sections, createdRenderers, section.second);
+
+        // When the file was loaded on two threads at the same time then the first result is kept
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        m_renderersCache.emplace(filename, std::move(renderers));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::map<sf::String, sf::String>& DefaultThemeLoader::load(const std::string& filename, const std::string& section)
+    {
+        // An empty filename is not considered an error and will result in an empty property list
+        if (filename == "")
+        {
+            static const std::map<sf::String, sf::String> emptyProperties;
+            return emptyProperties;
+        }
 
-                for (const auto& nestedProperty : child.get()->children)
+        const std::string lowercaseClassName = toLower(section);
+        while (true)
+        {
+            const std::shared_ptr<RendererData> rendererData = loadRenderer(filename, section);
+
+            // The properties are only converted to strings the first time they are requested
+            {
+                std::lock_guard<std::mutex> lock(cacheMutex);
+                const auto fileIt = m_propertiesCache.find(filename);
+                if (fileIt != m_propertiesCache.end())
                 {
-                    std::stringstream ss;
-                    DataIO::emit(nestedProperty, ss);
-                    m_propertiesCache[filename][name][toLower(nestedProperty->name)] = "{\n" + ss.str() + "}";
+                    const auto sectionIt = fileIt->second.find(lowercaseClassName);
+                    if (sectionIt != fileIt->second.end())
+                        return *sectionIt->second;
                 }
             }
+
+            std::map<sf::String, sf::String> properties = convertToStrings(*rendererData);
+
+            // The strings are only cached when the file wasn't flushed from the cache while they were being created
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            const auto fileIt = m_renderersCache.find(filename);
+            if (fileIt == m_renderersCache.end())
+                continue;
+
+            const auto rendererIt = fileIt->second.find(lowercaseClassName);
+            if ((rendererIt == fileIt->second.end()) || (rendererIt->second != rendererData))
+                continue;
+
+            const auto& storedProperties = *loadedProperties.insert(std::move(properties)).first;
+            m_propertiesCache[filename][lowercaseClassName] = &storedProperties;
+            return storedProperties;
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::map<sf::String, sf::String>& DefaultThemeLoader::load(const std::string& filename, const std::string& section)
+    std::shared_ptr<RendererData> DefaultThemeLoader::loadRenderer(const std::string& filename, const std::string& section)
     {
-        preload(filename);
+        // An empty filename is not considered an error and will result in an empty property list
+        if (filename == "")
+            return RendererData::createCopyOnWrite({});
 
-        std::string lowercaseClassName = toLower(section);
+        const std::string lowercaseClassName = toLower(section);
+        while (true)
+        {
+            preload(filename);
 
-        // An empty filename is not considered an error and will result in an empty property list
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            const auto fileIt = m_renderersCache.find(filename);
+            if (fileIt == m_renderersCache.end())
+                continue; // The cache was flushed after the file was loaded
+
+            const auto rendererIt = fileIt->second.find(lowercaseClassName);
+            if (rendererIt == fileIt->second.end())
+                throw Exception{"No section '" + section + "' was found in file '" + filename + "'."};
+
+            return rendererIt->second;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::string> DefaultThemeLoader::getSectionNames(const std::string& filename)
+    {
         if (filename == "")
-            return m_propertiesCache[""][lowercaseClassName];
+            return {};
+
+        while (true)
+        {
+            preload(filename);
 
-        if (m_propertiesCache[filename].find(lowercaseClassName) == m_propertiesCache[filename].end())
-            throw Exception{"No section '" + section + "' was found in file '" + filename + "'."};
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            const auto fileIt = m_renderersCache.find(filename);
+            if (fileIt == m_renderersCache.end())
+                continue; // The cache was flushed after the file was loaded
 
-        return m_propertiesCache[filename][lowercaseClassName];
+            std::vector<std::string> sectionNames;
+            for (const auto& renderer : fileIt->second)
+                sectionNames.push_back(renderer.first);
+
+            return sectionNames;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -221,6 +353,14 @@ namespace tgui
     {
         std::string fullFilename = getResourcePath() + filename;
 
+        const char* packedData;
+        std::size_t packedSize;
+        if (const auto pack = ResourcePack::findMountedFile(filename, packedData, packedSize))
+        {
+            contents.write(packedData, static_cast<std::streamsize>(packedSize));
+            return;
+        }
+
     #ifdef SFML_SYSTEM_ANDROID
         // If the file does not start with a slash then load it from the assets
         if (!fullFilename.empty() && (fullFilename[0] != '/'))
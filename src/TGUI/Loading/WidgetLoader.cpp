@@ -69,6 +69,22 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        std::shared_ptr<RendererData> loadRendererData(const std::unique_ptr<DataIO::Node>& node)
+        {
+            auto rendererData = RendererData::create();
+
+            for (const auto& pair : node->propertyValuePairs)
+                rendererData->propertyValuePairs[pair.first] = {pair.second->value};
+
+            // Nested sections are directly turned into renderers, they don't need to be written to text and parsed again
+            for (const auto& nestedProperty : node->children)
+                rendererData->propertyValuePairs[toLower(nestedProperty->name)] = {loadRendererData(nestedProperty)};
+
+            return rendererData;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         bool parseBoolean(std::string str)
         {
             str = toLower(str);
@@ -161,19 +177,7 @@ namespace tgui
                 /// TODO: Separate renderer section?
                 else if (toLower(childNode->name) == "renderer")
                 {
-                    auto rendererData = RendererData::create();
-
-                    for (const auto& pair : childNode->propertyValuePairs)
-                        rendererData->propertyValuePairs[pair.first] = {pair.second->value};
-
-                    for (const auto& nestedProperty : childNode->children)
-                    {
-                        std::stringstream ss;
-                        DataIO::emit(nestedProperty, ss);
-                        rendererData->propertyValuePairs[toLower(nestedProperty->name)] = {sf::String{"{\n" + ss.str() + "}"}};
-                    }
-
-                    widget->setRenderer(rendererData);
+                    widget->setRenderer(loadRendererData(childNode));
                 }
             }
             REMOVE_CHILD("tooltip");
@@ -184,13 +188,48 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        Widget::Ptr loadContainer(const std::unique_ptr<DataIO::Node>& node, Widget::Ptr widget)
+        // Number of containers of which the delayed child widgets are being loaded on this thread
+        thread_local unsigned int lazyLoadingDepth = 0;
+
+        // While the delayed child widgets of a container are loaded, the hidden containers inside them are delayed as well,
+        // even when lazy loading was disabled in the meantime
+        class LazyLoadingScope
         {
-            assert(widget != nullptr);
-            Container::Ptr container = std::static_pointer_cast<Container>(widget);
-            loadWidget(node, container);
+        public:
+            LazyLoadingScope()
+            {
+                ++lazyLoadingDepth;
+            }
 
-            for (const auto& childNode : node->children)
+            ~LazyLoadingScope()
+            {
+                --lazyLoadingDepth;
+            }
+
+            LazyLoadingScope(const LazyLoadingScope&) = delete;
+            LazyLoadingScope& operator=(const LazyLoadingScope&) = delete;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::unique_ptr<DataIO::Node> copyNode(const DataIO::Node& node, DataIO::Node* parent)
+        {
+            auto copy = std::make_unique<DataIO::Node>();
+            copy->parent = parent;
+            copy->name = node.name;
+            for (const auto& pair : node.propertyValuePairs)
+                copy->propertyValuePairs[pair.first] = std::make_unique<DataIO::ValueNode>(*pair.second);
+            for (const auto& child : node.children)
+                copy->children.push_back(copyNode(*child, copy.get()));
+
+            return copy;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void loadChildWidgets(const std::vector<std::unique_ptr<DataIO::Node>>& childNodes, Container& container)
+        {
+            for (const auto& childNode : childNodes)
             {
                 const auto nameSeparator = childNode->name.find('.');
                 const auto widgetType = childNode->name.substr(0, nameSeparator);
@@ -202,12 +241,72 @@ namespace tgui
                         className = Deserializer::deserialize(ObjectConverter::Type::String, childNode->name.substr(nameSeparator + 1)).getString();
 
                     tgui::Widget::Ptr childWidget = loadFunction(childNode, nullptr);
-                    container->add(childWidget, className);
+                    container.add(childWidget, className);
                 }
                 else
                     throw Exception{"No load function exists for widget type '" + widgetType + "'."};
             }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void collectWidgetNames(const std::vector<std::unique_ptr<DataIO::Node>>& childNodes, std::vector<sf::String>& widgetNames)
+        {
+            for (const auto& childNode : childNodes)
+            {
+                const std::string lowercaseName = toLower(childNode->name);
+                if ((lowercaseName == "renderer") || (lowercaseName == "tooltip"))
+                    continue;
+
+                const auto nameSeparator = childNode->name.find('.');
+                if (nameSeparator != std::string::npos)
+                    widgetNames.push_back(Deserializer::deserialize(ObjectConverter::Type::String, childNode->name.substr(nameSeparator + 1)).getString());
+
+                collectWidgetNames(childNode->children, widgetNames);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        Widget::Ptr loadContainer(const std::unique_ptr<DataIO::Node>& node, Widget::Ptr widget)
+        {
+            assert(widget != nullptr);
+            Container::Ptr container = std::static_pointer_cast<Container>(widget);
+            loadWidget(node, container);
+
+            // The child widgets of a hidden container are kept in their parsed form until they are needed
+            if ((WidgetLoader::getLazyLoading() || (lazyLoadingDepth > 0)) && !container->isVisible() && !node->children.empty())
+            {
+                auto childNodes = std::make_shared<std::vector<std::unique_ptr<DataIO::Node>>>(std::move(node->children));
+                node->children.clear();
+
+                std::vector<sf::String> widgetNames;
+                collectWidgetNames(*childNodes, widgetNames);
+
+                container->setLazyChildren([childNodes](Container& lazyContainer)
+                    {
+                        const LazyLoadingScope lazyLoadingScope;
 
+                        // Loading the widgets modifies the nodes. When a copy of the container still has to load them as well,
+                        // the widgets are loaded from a copy of the nodes.
+                        if (childNodes.use_count() == 1)
+                        {
+                            loadChildWidgets(*childNodes, lazyContainer);
+                            return;
+                        }
+
+                        std::vector<std::unique_ptr<DataIO::Node>> nodes;
+                        nodes.reserve(childNodes->size());
+                        for (const auto& childNode : *childNodes)
+                            nodes.push_back(copyNode(*childNode, nullptr));
+
+                        loadChildWidgets(nodes, lazyContainer);
+                    },
+                    std::move(widgetNames));
+                return container;
+            }
+
+            loadChildWidgets(node->children, *container);
             return container;
         }
 
@@ -1076,6 +1175,8 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool WidgetLoader::m_lazyLoading = false;
+
     std::map<std::string, WidgetLoader::LoadFunction> WidgetLoader::m_loadFunctions =
         {
             {"widget", loadWidget},
@@ -1114,8 +1215,25 @@ namespace tgui
 
     void WidgetLoader::load(Container::Ptr parent, std::stringstream& stream)
     {
-        auto rootNode = DataIO::parse(stream);
+        const std::string contents{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+        load(parent, contents.data(), contents.size());
+    }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetLoader::load(Container::Ptr parent, const char* data, std::size_t size)
+    {
+        // Binary widget files are recognized by their header
+        if (DataIO::isBinary(data, size))
+            loadWidgetsFromNode(parent, DataIO::parseBinary(data, size));
+        else
+            loadWidgetsFromNode(parent, DataIO::parse(data, size));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetLoader::loadWidgetsFromNode(const Container::Ptr& parent, const std::unique_ptr<DataIO::Node>& rootNode)
+    {
         if (rootNode->propertyValuePairs.size() != 0)
             loadWidget(rootNode, parent);
 
@@ -1153,6 +1271,20 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetLoader::setLazyLoading(bool lazyLoading)
+    {
+        m_lazyLoading = lazyLoading;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool WidgetLoader::getLazyLoading()
+    {
+        return m_lazyLoading;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -59,6 +59,27 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        void saveRendererData(const std::map<std::string, ObjectConverter>& propertyValuePairs, const std::unique_ptr<DataIO::Node>& node)
+        {
+            for (const auto& pair : propertyValuePairs)
+            {
+                // Skip "font = null"
+                if (pair.first == "font" && ObjectConverter{pair.second}.getString() == "null")
+                    continue;
+
+                if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                {
+                    node->children.emplace_back(std::make_unique<DataIO::Node>());
+                    node->children.back()->name = pair.first;
+                    saveRendererData(ObjectConverter{pair.second}.getRenderer()->propertyValuePairs, node->children.back());
+                }
+                else
+                    node->propertyValuePairs[pair.first] = std::make_unique<DataIO::ValueNode>(ObjectConverter{pair.second}.getString());
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         std::unique_ptr<DataIO::Node> saveWidget(Widget::Ptr widget)
         {
             sf::String widgetName;
@@ -99,27 +120,7 @@ namespace tgui
             {
                 node->children.emplace_back(std::make_unique<DataIO::Node>());
                 node->children.back()->name = "Renderer";
-                for (const auto& pair : widget->getRenderer()->getPropertyValuePairs())
-                {
-                    // Skip "font = null"
-                    if (pair.first == "font" && ObjectConverter{pair.second}.getString() == "null")
-                        continue;
-
-                    sf::String value = ObjectConverter{pair.second}.getString();
-                    if (pair.second.getType() == ObjectConverter::Type::RendererData)
-                    {
-                        std::stringstream ss{value};
-                        auto rendererRootNode = DataIO::parse(ss);
-                        if (!rendererRootNode->children.empty())
-                            node->children.back()->children.push_back(std::move(rendererRootNode->children[0]));
-                        else
-                            node->children.back()->children.push_back(std::move(rendererRootNode));
-
-                        node->children.back()->children.back()->name = pair.first;
-                    }
-                    else
-                        node->children.back()->propertyValuePairs[pair.first] = std::make_unique<DataIO::ValueNode>(value);
-                }
+                saveRendererData(widget->getRenderer()->getPropertyValuePairs(), node->children.back());
             }
 
             return node;
@@ -722,7 +723,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void WidgetSaver::save(Container::ConstPtr widget, std::stringstream& stream)
+    void WidgetSaver::save(Container::ConstPtr widget, std::ostream& stream)
+    {
+        DataIO::emit(saveWidgetsToNode(widget), stream);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetSaver::saveBinary(Container::ConstPtr widget, std::ostream& stream)
+    {
+        DataIO::emitBinary(saveWidgetsToNode(widget), stream);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> WidgetSaver::saveWidgetsToNode(const Container::ConstPtr& widget)
     {
         auto node = std::make_unique<DataIO::Node>();
         for (const auto& child : widget->getWidgets())
@@ -734,7 +749,7 @@ namespace tgui
                 throw Exception{"No save function exists for widget type '" + child->getWidgetType() + "'."};
         }
 
-        DataIO::emit(node, stream);
+        return node;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
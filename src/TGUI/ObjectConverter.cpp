@@ -27,6 +27,7 @@
 #include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 #include <cassert>
+#include <new>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,6 +35,67 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    ObjectConverter::ObjectConverter(const ObjectConverter& other) :
+        m_type      {other.m_type},
+        m_serialized{other.m_serialized},
+        m_string    {other.m_string}
+    {
+        copyValue(other);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter::ObjectConverter(ObjectConverter&& other) noexcept :
+        m_type      {other.m_type},
+        m_serialized{other.m_serialized},
+        m_string    {std::move(other.m_string)}
+    {
+        moveValue(std::move(other));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter::~ObjectConverter()
+    {
+        destroyValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& ObjectConverter::operator=(const ObjectConverter& other)
+    {
+        if (this != &other)
+        {
+            destroyValue();
+
+            m_type = other.m_type;
+            m_serialized = other.m_serialized;
+            m_string = other.m_string;
+            copyValue(other);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& ObjectConverter::operator=(ObjectConverter&& other) noexcept
+    {
+        if (this != &other)
+        {
+            destroyValue();
+
+            m_type = other.m_type;
+            m_serialized = other.m_serialized;
+            m_string = std::move(other.m_string);
+            moveValue(std::move(other));
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     const sf::String& ObjectConverter::getString()
     {
         assert(m_type != Type::None);
@@ -55,11 +117,11 @@ namespace tgui
 
         if (m_type == Type::String)
         {
-            m_value = Font(m_string);
+            new (&m_font) Font(m_string);
             m_type = Type::Font;
         }
 
-        return m_value.as<Font>();
+        return m_font;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -71,11 +133,11 @@ namespace tgui
 
         if (m_type == Type::String)
         {
-            m_value = Color(m_string);
+            new (&m_color) Color(m_string);
             m_type = Type::Color;
         }
 
-        return m_value.as<Color>();
+        return m_color;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -87,11 +149,11 @@ namespace tgui
 
         if (m_type == Type::String)
         {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::Number, m_string).getNumber();
+            m_number = Deserializer::deserialize(ObjectConverter::Type::Number, m_string).getNumber();
             m_type = Type::Number;
         }
 
-        return m_value.as<float>();
+        return m_number;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -103,16 +165,17 @@ namespace tgui
 
         if (m_type == Type::String)
         {
-            m_value = Layout{m_string};
+            new (&m_layout) Layout{m_string};
             m_type = Type::Layout;
         }
         else if (m_type == Type::Number)
         {
-            m_value = Layout{m_value.as<float>()};
+            const float number = m_number;
+            new (&m_layout) Layout{number};
             m_type = Type::Layout;
         }
 
-        return m_value.as<Layout>();
+        return m_layout;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -124,11 +187,11 @@ namespace tgui
 
         if (m_type == Type::String)
         {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::Outline, m_string).getOutline();
+            new (&m_outline) Outline(Deserializer::deserialize(ObjectConverter::Type::Outline, m_string).getOutline());
             m_type = Type::Outline;
         }
 
-        return m_value.as<Outline>();
+        return m_outline;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -140,11 +203,11 @@ namespace tgui
 
         if (m_type == Type::String)
         {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::Texture, m_string).getTexture();
+            new (&m_texture) Texture(Deserializer::deserialize(ObjectConverter::Type::Texture, m_string).getTexture());
             m_type = Type::Texture;
         }
 
-        return m_value.as<Texture>();
+        return m_texture;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -156,11 +219,11 @@ namespace tgui
 
         if (m_type == Type::String)
         {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::TextStyle, m_string).getTextStyle();
+            new (&m_textStyle) TextStyle(Deserializer::deserialize(ObjectConverter::Type::TextStyle, m_string).getTextStyle());
             m_type = Type::TextStyle;
         }
 
-        return m_value.as<TextStyle>();
+        return m_textStyle;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -172,11 +235,11 @@ namespace tgui
 
         if (m_type == Type::String)
         {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::RendererData, m_string).getRenderer();
+            new (&m_renderer) std::shared_ptr<RendererData>(Deserializer::deserialize(ObjectConverter::Type::RendererData, m_string).getRenderer());
             m_type = Type::RendererData;
         }
 
-        return m_value.as<std::shared_ptr<RendererData>>();
+        return m_renderer;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -187,6 +250,104 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ObjectConverter::copyValue(const ObjectConverter& other)
+    {
+        switch (other.m_type)
+        {
+            case Type::None:
+            case Type::String:
+                break;
+            case Type::Font:
+                new (&m_font) Font(other.m_font);
+                break;
+            case Type::Color:
+                new (&m_color) Color(other.m_color);
+                break;
+            case Type::Number:
+                m_number = other.m_number;
+                break;
+            case Type::Layout:
+                new (&m_layout) Layout(other.m_layout);
+                break;
+            case Type::Outline:
+                new (&m_outline) Outline(other.m_outline);
+                break;
+            case Type::Texture:
+                new (&m_texture) Texture(other.m_texture);
+                break;
+            case Type::TextStyle:
+                new (&m_textStyle) TextStyle(other.m_textStyle);
+                break;
+            case Type::RendererData:
+                new (&m_renderer) std::shared_ptr<RendererData>(other.m_renderer);
+                break;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ObjectConverter::moveValue(ObjectConverter&& other) noexcept
+    {
+        switch (other.m_type)
+        {
+            case Type::None:
+            case Type::String:
+                break;
+            case Type::Font:
+                new (&m_font) Font(std::move(other.m_font));
+                break;
+            case Type::Color:
+                new (&m_color) Color(other.m_color);
+                break;
+            case Type::Number:
+                m_number = other.m_number;
+                break;
+            case Type::Layout:
+                new (&m_layout) Layout(other.m_layout);
+                break;
+            case Type::Outline:
+                new (&m_outline) Outline(other.m_outline);
+                break;
+            case Type::Texture:
+                new (&m_texture) Texture(std::move(other.m_texture));
+                break;
+            case Type::TextStyle:
+                new (&m_textStyle) TextStyle(other.m_textStyle);
+                break;
+            case Type::RendererData:
+                new (&m_renderer) std::shared_ptr<RendererData>(std::move(other.m_renderer));
+                break;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ObjectConverter::destroyValue()
+    {
+        switch (m_type)
+        {
+            case Type::None:
+            case Type::String:
+            case Type::Color:
+            case Type::Number:
+            case Type::Layout:
+            case Type::Outline:
+            case Type::TextStyle:
+                break;
+            case Type::Font:
+                m_font.~Font();
+                break;
+            case Type::Texture:
+                m_texture.~Texture();
+                break;
+            case Type::RendererData:
+                m_renderer.~shared_ptr<RendererData>();
+                break;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
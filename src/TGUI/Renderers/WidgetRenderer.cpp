@@ -30,6 +30,46 @@
 
 namespace tgui
 {
+    void RendererData::notifyObservers(const std::string& property)
+    {
+        if (updateDepth > 0)
+        {
+            pendingChanges.insert(property);
+            return;
+        }
+
+        for (const auto& observer : observers)
+            observer.second(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererData::notifyObservers(const std::set<std::string>& properties)
+    {
+        if (updateDepth > 0)
+        {
+            pendingChanges.insert(properties.begin(), properties.end());
+            return;
+        }
+
+        if (properties.empty())
+            return;
+
+        for (const auto& observer : observers)
+        {
+            const auto it = batchObservers.find(observer.first);
+            if (it != batchObservers.end())
+                it->second(properties);
+            else
+            {
+                for (const auto& property : properties)
+                    observer.second(property);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_RENDERER_PROPERTY_GET_NUMBER(WidgetRenderer, Opacity, 1)
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -64,6 +104,47 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void WidgetRenderer::inheritFont(const Font& font)
+    {
+        if (!m_data->copyOnWrite || (font == nullptr))
+        {
+            setFont(font);
+            return;
+        }
+
+        // Look for shared data with this font, forgetting about the data that no widget uses anymore
+        std::shared_ptr<RendererData> fontData;
+        auto& inheritedFontData = m_data->inheritedFontData;
+        for (auto it = inheritedFontData.begin(); it != inheritedFontData.end();)
+        {
+            auto data = it->second.lock();
+            if (!data || it->first.expired())
+            {
+                it = inheritedFontData.erase(it);
+                continue;
+            }
+
+            if (it->first.lock() == font.getFont())
+                fontData = std::move(data);
+
+            ++it;
+        }
+
+        if (!fontData)
+        {
+            fontData = RendererData::createCopyOnWrite(m_data->propertyValuePairs);
+            fontData->propertyValuePairs["font"] = font;
+            inheritedFontData.emplace_back(font.getFont(), fontData);
+        }
+
+        // The observers of shared data are stored in the renderer, so they have to be informed here
+        m_data = fontData;
+        for (const auto& observer : m_copyOnWriteObservers)
+            observer.second("font");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void WidgetRenderer::setProperty(const std::string& property, const std::string& value)
     {
         setProperty(property, ObjectConverter{sf::String{value}});
@@ -75,10 +156,9 @@ namespace tgui
     {
         std::string lowercaseProperty = toLower(property);
 
+        detachSharedData();
         m_data->propertyValuePairs[lowercaseProperty] = value;
-
-        for (const auto& observer : m_data->observers)
-            observer.second(lowercaseProperty);
+        m_data->notifyObservers(lowercaseProperty);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -101,16 +181,58 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void WidgetRenderer::subscribe(void* id, const std::function<void(const std::string& property)>& function)
+    void WidgetRenderer::beginUpdate()
     {
-        m_data->observers[id] = function;
+        // The update state is stored in the data, which thus can no longer be shared
+        detachSharedData();
+        m_data->updateDepth++;
+        m_updatedData.push_back(m_data);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::endUpdate()
+    {
+        if (m_updatedData.empty())
+            return;
+
+        // The data might have been replaced during the update, the update has to end on the data on which it started
+        const std::shared_ptr<RendererData> data = std::move(m_updatedData.back());
+        m_updatedData.pop_back();
+
+        data->updateDepth--;
+        if (data->updateDepth == 0)
+        {
+            const std::set<std::string> properties = std::move(data->pendingChanges);
+            data->pendingChanges.clear();
+            data->notifyObservers(properties);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::subscribe(void* id,
+                                   const std::function<void(const std::string& property)>& function,
+                                   const std::function<void(const std::set<std::string>& properties)>& batchFunction)
+    {
+        auto& observers = m_data->copyOnWrite ? m_copyOnWriteObservers : m_data->observers;
+        auto& batchObservers = m_data->copyOnWrite ? m_copyOnWriteBatchObservers : m_data->batchObservers;
+
+        observers[id] = function;
+        if (batchFunction)
+            batchObservers[id] = batchFunction;
+        else
+            batchObservers.erase(id);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void WidgetRenderer::unsubscribe(void* id)
     {
+        m_copyOnWriteObservers.erase(id);
+        m_copyOnWriteBatchObservers.erase(id);
         m_data->observers.erase(id);
+        m_data->batchObservers.erase(id);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -118,12 +240,15 @@ namespace tgui
     void WidgetRenderer::setData(const std::shared_ptr<RendererData>& data)
     {
         m_data = data;
+        m_ownsSharedData = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::shared_ptr<RendererData> WidgetRenderer::getData() const
     {
+        // The caller may change the data or share it with other widgets, which would otherwise alter the default renderer
+        detachSharedData();
         return m_data;
     }
 
@@ -131,7 +256,43 @@ namespace tgui
 
     std::shared_ptr<RendererData> WidgetRenderer::clone() const
     {
-        return std::make_shared<RendererData>(*m_data);
+        auto data = std::make_shared<RendererData>(*m_data);
+        data->copyOnWrite = false;
+        data->updateDepth = 0;
+        data->pendingChanges.clear();
+        return data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::detachSharedData() const
+    {
+        if (!m_data->copyOnWrite)
+            return;
+
+        m_data = RendererData::create(m_data->propertyValuePairs);
+        for (auto& pair : m_data->propertyValuePairs)
+        {
+            if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                pair.second = {RendererData::create(pair.second.getRenderer()->propertyValuePairs)};
+        }
+
+        m_data->observers = std::move(m_copyOnWriteObservers);
+        m_data->batchObservers = std::move(m_copyOnWriteBatchObservers);
+        m_copyOnWriteObservers.clear();
+        m_copyOnWriteBatchObservers.clear();
+        m_ownsSharedData = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::shareDataWith(const WidgetRenderer& other)
+    {
+        if (!other.m_ownsSharedData)
+            other.detachSharedData();
+
+        m_data = other.m_data;
+        m_ownsSharedData = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,258 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/StyledSpans.hpp>
+#include <TGUI/GlyphRunCache.hpp>
+
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        bool isSameColor(const Color& left, const Color& right)
+        {
+            if (left.isSet() != right.isSet())
+                return false;
+
+            return !left.isSet() || (sf::Color(left) == sf::Color(right));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    StyledSpans::StyledSpans(std::size_t length)
+    {
+        insert(0, length);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t StyledSpans::getLength() const
+    {
+        return m_length;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void StyledSpans::append(std::size_t length, Color color, TextStyle style)
+    {
+        const std::size_t start = m_length;
+        insert(start, length);
+        setStyle(start, length, color, style);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void StyledSpans::setStyle(std::size_t start, std::size_t length, Color color, TextStyle style)
+    {
+        if ((start >= m_length) || (length == 0))
+            return;
+
+        length = std::min(length, m_length - start);
+
+        const std::size_t first = splitAt(start);
+        const std::size_t last = splitAt(start + length);
+        m_runs.erase(m_runs.begin() + first + 1, m_runs.begin() + last);
+
+        m_runs[first].color = color;
+        if (style.isSet())
+            m_runs[first].style = TextStyle{style & ~static_cast<sf::Uint32>(sf::Text::Bold)};
+        else
+            m_runs[first].style = style;
+
+        mergeWithPrevious(first + 1);
+        mergeWithPrevious(first);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void StyledSpans::insert(std::size_t position, std::size_t count)
+    {
+        if (count == 0)
+            return;
+
+        position = std::min(position, m_length);
+
+        const std::size_t index = splitAt(position);
+        for (std::size_t i = index; i < m_runs.size(); ++i)
+            m_runs[i].start += count;
+
+        m_runs.insert(m_runs.begin() + index, Run{position, {}, {}});
+        m_length += count;
+
+        mergeWithPrevious(index + 1);
+        mergeWithPrevious(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void StyledSpans::erase(std::size_t position, std::size_t count)
+    {
+        if ((position >= m_length) || (count == 0))
+            return;
+
+        count = std::min(count, m_length - position);
+
+        const std::size_t first = splitAt(position);
+        const std::size_t last = splitAt(position + count);
+        m_runs.erase(m_runs.begin() + first, m_runs.begin() + last);
+        for (std::size_t i = first; i < m_runs.size(); ++i)
+            m_runs[i].start -= count;
+
+        m_length -= count;
+        mergeWithPrevious(first);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void StyledSpans::clear()
+    {
+        m_runs.clear();
+        m_length = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t StyledSpans::getSpanCount() const
+    {
+        return m_runs.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    StyledSpans::Span StyledSpans::getSpan(std::size_t position) const
+    {
+        if (position >= m_length)
+            return {};
+
+        const auto it = std::upper_bound(m_runs.begin(), m_runs.end(), position, [](std::size_t pos, const Run& run){ return pos < run.start; }) - 1;
+        const std::size_t end = (it + 1 != m_runs.end()) ? (it + 1)->start : m_length;
+
+        Span span;
+        span.start = it->start;
+        span.length = end - it->start;
+        span.color = it->color;
+        span.style = it->style;
+        return span;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<StyledSpans::Span> StyledSpans::getSpans(std::size_t start, std::size_t length) const
+    {
+        std::vector<Span> spans;
+        if (start >= m_length)
+            return spans;
+
+        const std::size_t end = start + std::min(length, m_length - start);
+        auto it = std::upper_bound(m_runs.begin(), m_runs.end(), start, [](std::size_t pos, const Run& run){ return pos < run.start; }) - 1;
+        for (; (it != m_runs.end()) && (it->start < end); ++it)
+        {
+            const std::size_t runEnd = (it + 1 != m_runs.end()) ? (it + 1)->start : m_length;
+
+            Span span;
+            span.start = std::max(it->start, start);
+            span.length = std::min(runEnd, end) - span.start;
+            span.color = it->color;
+            span.style = it->style;
+            spans.push_back(span);
+        }
+
+        return spans;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float StyledSpans::appendGlyphs(std::vector<sf::Vertex>& vertices, const Font& font, unsigned int characterSize, const sf::String& string,
+                                    std::size_t start, std::size_t length, sf::Vector2f position, const sf::Color& defaultColor, float opacity,
+                                    bool ignoreColors) const
+    {
+        float x = position.x;
+        sf::Uint32 prevChar = 0;
+        const auto addPart = [&](std::size_t partStart, std::size_t partLength, const sf::Color& color, TextStyle style)
+        {
+            if (partLength == 0)
+                return;
+
+            // The kerning between the parts is the same as if the line was drawn at once
+            x += font.getKerning(prevChar, string[partStart], characterSize);
+            x = GlyphRunCache::appendGlyphs(vertices, font, characterSize, style, string, partStart, partLength, {x, position.y},
+                                            Color::calcColorOpacity(color, opacity));
+            prevChar = string[partStart + partLength - 1];
+        };
+
+        const std::size_t end = start + length;
+        const std::size_t styledEnd = std::min(end, m_length);
+        if (start < styledEnd)
+        {
+            for (const auto& span : getSpans(start, styledEnd - start))
+                addPart(span.start, span.length, (span.color.isSet() && !ignoreColors) ? sf::Color(span.color) : defaultColor, span.style);
+        }
+
+        // Characters behind the spans don't have a color or style
+        const std::size_t unstyledStart = std::max(start, styledEnd);
+        addPart(unstyledStart, end - unstyledStart, defaultColor, sf::Text::Regular);
+        return x;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t StyledSpans::splitAt(std::size_t position)
+    {
+        if (position >= m_length)
+            return m_runs.size();
+
+        const auto it = std::upper_bound(m_runs.begin(), m_runs.end(), position, [](std::size_t pos, const Run& run){ return pos < run.start; }) - 1;
+        const std::size_t index = static_cast<std::size_t>(it - m_runs.begin());
+        if (it->start == position)
+            return index;
+
+        Run run = *it;
+        run.start = position;
+        m_runs.insert(m_runs.begin() + index + 1, run);
+        return index + 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void StyledSpans::mergeWithPrevious(std::size_t index)
+    {
+        if ((index == 0) || (index >= m_runs.size()))
+            return;
+
+        const Run& previous = m_runs[index - 1];
+        const Run& run = m_runs[index];
+        if (isSameColor(previous.color, run.color) && (static_cast<sf::Uint32>(previous.style) == static_cast<sf::Uint32>(run.style)))
+            m_runs.erase(m_runs.begin() + index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Text.hpp>
+#include <TGUI/GlyphRunCache.hpp>
 #include <TGUI/Global.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <cmath>
@@ -43,7 +44,8 @@ namespace tgui
 
     void Text::setString(const sf::String& string)
     {
-        m_text.setString(string);
+        m_string = string;
+        m_glyphRun = nullptr;
         recalculateSize();
     }
 
@@ -51,14 +53,15 @@ namespace tgui
 
     const sf::String& Text::getString() const
     {
-        return m_text.getString();
+        return m_string;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::setCharacterSize(unsigned int size)
     {
-        m_text.setCharacterSize(size);
+        m_characterSize = size;
+        m_glyphRun = nullptr;
         recalculateSize();
     }
 
@@ -66,7 +69,7 @@ namespace tgui
 
     unsigned int Text::getCharacterSize() const
     {
-        return m_text.getCharacterSize();
+        return m_characterSize;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -74,12 +77,7 @@ namespace tgui
     void Text::setColor(Color color)
     {
         m_color = color;
-
-    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setFillColor(Color::calcColorOpacity(color, m_opacity));
-    #else
-        m_text.setColor(Color::calcColorOpacity(color, m_opacity));
-    #endif
+        setVertexColor(Color::calcColorOpacity(color, m_opacity));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -94,12 +92,7 @@ namespace tgui
     void Text::setOpacity(float opacity)
     {
         m_opacity = opacity;
-
-    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setFillColor(Color::calcColorOpacity(m_color, opacity));
-    #else
-        m_text.setColor(Color::calcColorOpacity(m_color, opacity));
-    #endif
+        setVertexColor(Color::calcColorOpacity(m_color, opacity));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -114,9 +107,7 @@ namespace tgui
     void Text::setFont(Font font)
     {
         m_font = font;
-        if (font)
-            m_text.setFont(*font.getFont());
-
+        m_glyphRun = nullptr;
         recalculateSize();
     }
 
@@ -131,9 +122,10 @@ namespace tgui
 
     void Text::setStyle(TextStyle style)
     {
-        if (style != m_text.getStyle())
+        if (style != m_style)
         {
-            m_text.setStyle(style);
+            m_style = style;
+            m_glyphRun = nullptr;
             recalculateSize();
         }
     }
@@ -142,37 +134,81 @@ namespace tgui
 
     TextStyle Text::getStyle() const
     {
-        return m_text.getStyle();
+        return m_style;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::Vector2f Text::findCharacterPos(std::size_t index) const
     {
-        return m_text.findCharacterPos(index);
+        if (m_font == nullptr)
+            return {0, 0};
+
+        if (index > m_string.getSize())
+            index = m_string.getSize();
+
+        const bool bold = (m_style & sf::Text::Bold) != 0;
+        const float whitespaceWidth = m_font.getGlyphAdvance(' ', m_characterSize, bold);
+        const float lineSpacing = m_font.getLineSpacing(m_characterSize);
+
+        sf::Vector2f position;
+        sf::Uint32 prevChar = 0;
+        for (std::size_t i = 0; i < index; ++i)
+        {
+            const sf::Uint32 curChar = m_string[i];
+            position.x += m_font.getKerning(prevChar, curChar, m_characterSize);
+            prevChar = curChar;
+
+            if (curChar == ' ')
+                position.x += whitespaceWidth;
+            else if (curChar == '\t')
+                position.x += whitespaceWidth * 4;
+            else if (curChar == '\n')
+            {
+                position.y += lineSpacing;
+                position.x = 0;
+            }
+            else
+                position.x += m_font.getGlyphAdvance(curChar, m_characterSize, bold);
+        }
+
+        return position;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        if ((m_font == nullptr) || m_string.isEmpty())
+            return;
+
+        // Texts with the same string and color share their vertices
+        if (!m_glyphRun)
+            m_glyphRun = GlyphRunCache::getGlyphRun(m_font, m_characterSize, m_style, m_string, m_vertexColor);
+
+        if (m_glyphRun->empty())
+            return;
+
         states.transform *= getTransform();
+        drawGlyphs(target, states, m_glyphRun->data(), m_glyphRun->size(), m_font, m_characterSize);
+    }
 
-        // Round the position to avoid blurry text
-        const float* matrix = states.transform.getMatrix();
-        states.transform = sf::Transform{matrix[0], matrix[4], std::round(matrix[12]),
-                                         matrix[1], matrix[5], std::floor(matrix[13]),
-                                         matrix[3], matrix[7], matrix[15]};
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        target.draw(m_text, states);
+    void Text::setVertexColor(sf::Color color)
+    {
+        if (color != m_vertexColor)
+        {
+            m_vertexColor = color;
+            m_glyphRun = nullptr;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::recalculateSize()
     {
-        const std::shared_ptr<sf::Font> font = m_font;
-        if (font == nullptr)
+        if (m_font == nullptr)
         {
             m_size = {0, 0};
             return;
@@ -182,12 +218,12 @@ namespace tgui
         float maxWidth = 0;
         unsigned int lines = 1;
         sf::Uint32 prevChar = 0;
-        const sf::String& string = m_text.getString();
-        const bool bold = (m_text.getStyle() & sf::Text::Bold) != 0;
-        const unsigned int textSize = m_text.getCharacterSize();
+        const sf::String& string = m_string;
+        const bool bold = (m_style & sf::Text::Bold) != 0;
+        const unsigned int textSize = m_characterSize;
         for (std::size_t i = 0; i < string.getSize(); ++i)
         {
-            const float kerning = static_cast<float>(font->getKerning(prevChar, string[i], textSize));
+            const float kerning = m_font.getKerning(prevChar, string[i], textSize);
             if (string[i] == '\n')
             {
                 maxWidth = std::max(maxWidth, width);
@@ -195,15 +231,15 @@ namespace tgui
                 lines++;
             }
             else if (string[i] == '\t')
-                width += (static_cast<float>(font->getGlyph(' ', textSize, bold).advance) * 4) + kerning;
+                width += (m_font.getGlyphAdvance(' ', textSize, bold) * 4) + kerning;
             else
-                width += static_cast<float>(font->getGlyph(string[i], textSize, bold).advance) + kerning;
+                width += m_font.getGlyphAdvance(string[i], textSize, bold) + kerning;
 
             prevChar = string[i];
         }
 
-        const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_font, m_text.getCharacterSize(), m_text.getStyle());
-        m_size = {std::max(maxWidth, width), lines * font->getLineSpacing(m_text.getCharacterSize()) + extraVerticalSpace};
+        const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_font, m_characterSize, m_style);
+        m_size = {std::max(maxWidth, width), lines * m_font.getLineSpacing(m_characterSize) + extraVerticalSpace};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -253,9 +289,20 @@ namespace tgui
         const bool bold = (style & sf::Text::Bold) != 0;
 
         // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
-        const float lineHeight = characterSize
-                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.height
-                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.top;
+        float lineHeight;
+        const std::shared_ptr<DistanceFieldAtlas> atlas = font.getDistanceFieldAtlas();
+        if (atlas)
+        {
+            // The bounds of the glyph in the atlas are extended with the spread on every side
+            const sf::FloatRect& bounds = atlas->getGlyph('g', bold).bounds;
+            lineHeight = characterSize + (bounds.height + bounds.top - atlas->getSpread()) * atlas->getScale(characterSize);
+        }
+        else
+        {
+            lineHeight = characterSize
+                         + font.getFont()->getGlyph('g', characterSize, bold).bounds.height
+                         + font.getFont()->getGlyph('g', characterSize, bold).bounds.top;
+        }
 
         // Get the line spacing sfml returns
         const float lineSpacing = font.getFont()->getLineSpacing(characterSize);
@@ -266,21 +313,47 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    sf::String Text::wordWrap(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace)
+    float Text::getLineWidth(const sf::String& text, Font font, unsigned int characterSize, TextStyle style)
     {
         if (font == nullptr)
-            return "";
+            return 0;
+
+        const bool bold = (style & sf::Text::Bold) != 0;
+
+        float width = 0;
+        sf::Uint32 prevChar = 0;
+        for (const sf::Uint32 curChar : text)
+        {
+            width += font.getKerning(prevChar, curChar, characterSize);
+            if (curChar == '\t')
+                width += font.getGlyphAdvance(' ', characterSize, bold) * 4;
+            else
+                width += font.getGlyphAdvance(curChar, characterSize, bold);
+
+            prevChar = curChar;
+        }
+
+        return width;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::size_t> Text::findLineBreaks(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace)
+    {
+        std::vector<std::size_t> lineBreaks;
+        if (font == nullptr)
+            return lineBreaks;
 
-        sf::String result;
+        const std::size_t textLength = text.getSize();
         std::size_t index = 0;
-        while (index < text.getSize())
+        while (index < textLength)
         {
             const std::size_t oldIndex = index;
 
             // Find out how many characters we can get on this line
             float width = 0;
             sf::Uint32 prevChar = 0;
-            for (std::size_t i = index; i < text.getSize(); ++i)
+            for (std::size_t i = index; i < textLength; ++i)
             {
                 float charWidth;
                 const sf::Uint32 curChar = text[i];
@@ -290,11 +363,11 @@ namespace tgui
                     break;
                 }
                 else if (curChar == '\t')
-                    charWidth = font.getFont()->getGlyph(' ', textSize, bold).advance * 4;
+                    charWidth = font.getGlyphAdvance(' ', textSize, bold) * 4;
                 else
-                    charWidth = font.getFont()->getGlyph(curChar, textSize, bold).advance;
+                    charWidth = font.getGlyphAdvance(curChar, textSize, bold);
 
-                const float kerning = font.getFont()->getKerning(prevChar, curChar, textSize);
+                const float kerning = font.getKerning(prevChar, curChar, textSize);
                 if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
                 {
                     width += kerning + charWidth;
@@ -314,7 +387,7 @@ namespace tgui
             if (text[index-1] != '\n')
             {
                 const std::size_t indexWithoutWordWrap = index;
-                if ((index < text.getSize()) && (!isWhitespace(text[index])))
+                if ((index < textLength) && (!isWhitespace(text[index])))
                 {
                     std::size_t wordWrapCorrection = 0;
                     while ((index > oldIndex) && (!isWhitespace(text[index - 1])))
@@ -332,26 +405,77 @@ namespace tgui
             // If the next line starts with just a space, then the space need not be visible
             if (dropLeadingSpace)
             {
-                if ((index < text.getSize()) && (text[index] == ' '))
+                if ((index < textLength) && (text[index] == ' '))
                 {
                     if ((index == 0) || (!isWhitespace(text[index-1])))
                     {
                         // But two or more spaces indicate that it is not a normal text and the spaces should not be ignored
-                        if (((index + 1 < text.getSize()) && (!isWhitespace(text[index + 1]))) || (index + 1 == text.getSize()))
+                        if (((index + 1 < textLength) && (!isWhitespace(text[index + 1]))) || (index + 1 == textLength))
                             index++;
                     }
                 }
             }
 
-            result += text.substring(oldIndex, index - oldIndex);
-            if ((index < text.getSize()) && (text[index-1] != '\n'))
-                result += "\n";
+            // A newline at the end of the text is followed by an empty line
+            if ((index < textLength) || (text[index-1] == '\n'))
+                lineBreaks.push_back(index);
+        }
+
+        return lineBreaks;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String Text::wordWrap(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace)
+    {
+        if (font == nullptr)
+            return "";
+
+        const std::vector<std::size_t> lineBreaks = findLineBreaks(maxWidth, text, font, textSize, bold, dropLeadingSpace);
+
+        // Insert a newline at every position where the line is broken, unless there already is one
+        std::basic_string<sf::Uint32> result;
+        result.reserve(text.getSize() + lineBreaks.size());
+
+        std::size_t lineStart = 0;
+        for (const std::size_t lineBreak : lineBreaks)
+        {
+            result.append(text.getData() + lineStart, text.getData() + lineBreak);
+            if (text[lineBreak-1] != '\n')
+                result += '\n';
+
+            lineStart = lineBreak;
         }
 
+        result.append(text.getData() + lineStart, text.getData() + text.getSize());
         return result;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::drawGlyphs(sf::RenderTarget& target, sf::RenderStates states, const sf::Vertex* vertices, std::size_t vertexCount,
+                          const Font& font, unsigned int characterSize)
+    {
+        if ((font == nullptr) || (vertexCount == 0))
+            return;
+
+        // Round the position to avoid blurry text
+        const float* matrix = states.transform.getMatrix();
+        states.transform = sf::Transform{matrix[0], matrix[4], std::round(matrix[12]),
+                                         matrix[1], matrix[5], std::floor(matrix[13]),
+                                         matrix[3], matrix[7], matrix[15]};
+
+        const std::shared_ptr<DistanceFieldAtlas> atlas = font.getDistanceFieldAtlas();
+        if (atlas)
+            atlas->draw(target, vertices, vertexCount, states);
+        else
+        {
+            states.texture = &font.getFont()->getTexture(characterSize);
+            target.draw(vertices, vertexCount, sf::Triangles, states);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,314 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TextLayout.hpp>
+#include <TGUI/GlyphRunCache.hpp>
+#include <TGUI/Global.hpp>
+#include <TGUI/Text.hpp>
+
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    void TextLayout::setString(const sf::String& string)
+    {
+        if (string == m_string)
+            return;
+
+        m_string = string;
+        m_linesNeedUpdate = true;
+        m_verticesNeedUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::String& TextLayout::getString() const
+    {
+        return m_string;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayout::setFont(Font font)
+    {
+        if (font.getFont() == m_font.getFont())
+            return;
+
+        m_font = font;
+        m_linesNeedUpdate = true;
+        m_verticesNeedUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Font TextLayout::getFont() const
+    {
+        return m_font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayout::setCharacterSize(unsigned int size)
+    {
+        if (size == m_characterSize)
+            return;
+
+        m_characterSize = size;
+        m_linesNeedUpdate = true;
+        m_verticesNeedUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextLayout::getCharacterSize() const
+    {
+        return m_characterSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayout::setStyle(TextStyle style)
+    {
+        if (style == m_style)
+            return;
+
+        m_style = style;
+        m_linesNeedUpdate = true;
+        m_verticesNeedUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextStyle TextLayout::getStyle() const
+    {
+        return m_style;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayout::setColor(Color color)
+    {
+        m_color = color;
+
+        const sf::Color vertexColor = Color::calcColorOpacity(m_color, m_opacity);
+        for (auto& vertex : m_vertices)
+            vertex.color = vertexColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Color TextLayout::getColor() const
+    {
+        return m_color;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayout::setOpacity(float opacity)
+    {
+        m_opacity = opacity;
+
+        const sf::Color vertexColor = Color::calcColorOpacity(m_color, m_opacity);
+        for (auto& vertex : m_vertices)
+            vertex.color = vertexColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextLayout::getOpacity() const
+    {
+        return m_opacity;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayout::setMaximumWidth(float maxWidth)
+    {
+        if (maxWidth == m_maximumWidth)
+            return;
+
+        m_maximumWidth = maxWidth;
+        m_linesNeedUpdate = true;
+        m_verticesNeedUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextLayout::getMaximumWidth() const
+    {
+        return m_maximumWidth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayout::setAlignment(Alignment alignment, float width)
+    {
+        if ((alignment == m_alignment) && ((width == m_alignmentWidth) || (alignment == Alignment::Left)))
+            return;
+
+        m_alignment = alignment;
+        m_alignmentWidth = width;
+        m_verticesNeedUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextLayout::Alignment TextLayout::getAlignment() const
+    {
+        return m_alignment;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextLayout::getLineCount() const
+    {
+        updateLines();
+        return m_lines.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2f TextLayout::getSize() const
+    {
+        updateLines();
+        return m_size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayout::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        if (m_font == nullptr)
+            return;
+
+        updateVertices();
+        if (m_vertices.empty())
+            return;
+
+        states.transform *= getTransform();
+        Text::drawGlyphs(target, states, m_vertices.data(), m_vertices.size(), m_font, m_characterSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayout::updateLines() const
+    {
+        if (!m_linesNeedUpdate)
+            return;
+
+        m_linesNeedUpdate = false;
+        m_lines.clear();
+        m_size = {0, 0};
+        if (m_font == nullptr)
+            return;
+
+        const bool bold = (m_style & sf::Text::Bold) != 0;
+        const std::vector<std::size_t> lineBreaks = Text::findLineBreaks(m_maximumWidth, m_string, m_font, m_characterSize, bold);
+
+        m_lines.reserve(lineBreaks.size() + 1);
+        for (std::size_t i = 0; i <= lineBreaks.size(); ++i)
+        {
+            Line line;
+            line.start = (i > 0) ? lineBreaks[i-1] : 0;
+            std::size_t lineEnd = (i < lineBreaks.size()) ? lineBreaks[i] : m_string.getSize();
+
+            // The newline character is not part of the line
+            if ((lineEnd > line.start) && (m_string[lineEnd-1] == '\n'))
+                --lineEnd;
+
+            line.length = lineEnd - line.start;
+
+            float x = 0;
+            float textWidth = 0;
+            sf::Uint32 prevChar = 0;
+            for (std::size_t j = line.start; j < lineEnd; ++j)
+            {
+                const sf::Uint32 curChar = m_string[j];
+                x += m_font.getKerning(prevChar, curChar, m_characterSize);
+                prevChar = curChar;
+
+                if (curChar == '\t')
+                    x += m_font.getGlyphAdvance(' ', m_characterSize, bold) * 4;
+                else
+                    x += m_font.getGlyphAdvance(curChar, m_characterSize, bold);
+
+                if ((curChar >= 128) || !isWhitespace(static_cast<char>(curChar)))
+                    textWidth = x;
+            }
+
+            line.width = x;
+            line.textWidth = textWidth;
+            m_lines.push_back(line);
+
+            m_size.x = std::max(m_size.x, line.width);
+        }
+
+        m_size.y = (m_lines.size() * m_font.getLineSpacing(m_characterSize)) + Text::calculateExtraVerticalSpace(m_font, m_characterSize, m_style);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayout::updateVertices() const
+    {
+        updateLines();
+        if (!m_verticesNeedUpdate)
+            return;
+
+        m_verticesNeedUpdate = false;
+        m_vertices.clear();
+        if (m_font == nullptr)
+            return;
+
+        const float lineSpacing = m_font.getLineSpacing(m_characterSize);
+        const sf::Color color = Color::calcColorOpacity(m_color, m_opacity);
+
+        std::size_t glyphCount = 0;
+        for (const auto& line : m_lines)
+            glyphCount += line.length;
+        m_vertices.reserve(6 * glyphCount);
+
+        for (std::size_t i = 0; i < m_lines.size(); ++i)
+        {
+            const Line& line = m_lines[i];
+
+            // Lines are placed on whole pixels, like separate texts would be
+            float left = 0;
+            if (m_alignment == Alignment::Center)
+                left = std::round((m_alignmentWidth - line.textWidth) / 2.f);
+            else if (m_alignment == Alignment::Right)
+                left = std::round(m_alignmentWidth - line.textWidth);
+
+            GlyphRunCache::appendGlyphs(m_vertices, m_font, m_characterSize, m_style, m_string, line.start, line.length,
+                                        {left, std::floor(i * lineSpacing)}, color);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,7 @@
 #include <TGUI/Texture.hpp>
 #include <TGUI/Exception.hpp>
 #include <TGUI/TextureManager.hpp>
+#include <TGUI/Loading/ResourcePack.hpp>
 
 #include <cassert>
 
@@ -37,6 +38,18 @@ namespace tgui
     Texture::ImageLoaderFunc Texture::m_imageLoader = [](const sf::String& filename) -> std::unique_ptr<sf::Image>
         {
             auto image = std::make_unique<sf::Image>();
+
+            // The pack is kept alive while the image is decoded, it could be unmounted on another thread
+            const char* packedData;
+            std::size_t packedSize;
+            if (const auto pack = ResourcePack::findMountedFile(filename.toAnsiString(), packedData, packedSize))
+            {
+                if (image->loadFromMemory(packedData, packedSize))
+                    return image;
+                else
+                    return nullptr;
+            }
+
             if (image->loadFromFile(filename))
                 return image;
             else
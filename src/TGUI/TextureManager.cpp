@@ -27,11 +27,20 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
 
+#include <mutex>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     std::map<std::string, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    std::map<std::string, std::unique_ptr<sf::Image>> TextureManager::m_preloadedImages;
+
+    namespace
+    {
+        // Protects m_preloadedImages, images are preloaded on worker threads while the gui thread creates textures
+        std::mutex preloadedImagesMutex;
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -75,9 +84,31 @@ namespace tgui
         texture.setCopyCallback(&TextureManager::copyTexture);
         texture.setDestructCallback(&TextureManager::removeTexture);
 
-        // Load the image
+        // Load the image, unless it was already decoded in advance or another part of it is already being used
         auto data = imageIt->second.back().data;
-        data->image = texture.getImageLoader()(filename);
+        for (const auto& otherDataHolder : imageIt->second)
+        {
+            if ((otherDataHolder.data != data) && (otherDataHolder.data->image != nullptr))
+            {
+                data->image = std::make_unique<sf::Image>(*otherDataHolder.data->image);
+                break;
+            }
+        }
+
+        if (data->image == nullptr)
+        {
+            std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+            const auto preloadedIt = m_preloadedImages.find(filename);
+            if (preloadedIt != m_preloadedImages.end())
+            {
+                data->image = std::move(preloadedIt->second);
+                m_preloadedImages.erase(preloadedIt);
+            }
+        }
+
+        if (data->image == nullptr)
+            data->image = texture.getImageLoader()(filename);
+
         if (data->image != nullptr)
         {
             // Create a texture from the image
@@ -149,6 +180,34 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::preloadImage(const std::string& filename)
+    {
+        {
+            std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+            if (m_preloadedImages.find(filename) != m_preloadedImages.end())
+                return true;
+        }
+
+        // The image is decoded without holding the lock, so that several images can be decoded at the same time
+        auto image = Texture::getImageLoader()(filename);
+        if (image == nullptr)
+            return false;
+
+        std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+        m_preloadedImages.emplace(filename, std::move(image));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::clearPreloadedImages()
+    {
+        std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+        m_preloadedImages.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
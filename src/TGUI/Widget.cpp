@@ -62,7 +62,8 @@ namespace tgui
 
     Widget::Widget()
     {
-        m_renderer->subscribe(this, [this](const std::string& property){ rendererChangedCallback(property); });
+        m_renderer->subscribe(this, [this](const std::string& property){ rendererChangedCallback(property); },
+                              [this](const std::set<std::string>& properties){ rendererChangedCallback(properties); });
 
         // The opacity is 1 by default and thus has to be explicitly initialized
         m_opacityCached = getRenderer()->getOpacity();
@@ -96,7 +97,8 @@ namespace tgui
         m_fontCached                   {other.m_fontCached},
         m_opacityCached                {other.m_opacityCached}
     {
-        m_renderer->subscribe(this, [this](const std::string& property){ rendererChangedCallback(property); });
+        m_renderer->subscribe(this, [this](const std::string& property){ rendererChangedCallback(property); },
+                              [this](const std::set<std::string>& properties){ rendererChangedCallback(properties); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -129,7 +131,8 @@ namespace tgui
         m_opacityCached                {std::move(other.m_opacityCached)}
     {
         other.m_renderer->unsubscribe(&other);
-        m_renderer->subscribe(this, [this](const std::string& property){ rendererChangedCallback(property); });
+        m_renderer->subscribe(this, [this](const std::string& property){ rendererChangedCallback(property); },
+                              [this](const std::set<std::string>& properties){ rendererChangedCallback(properties); });
 
         other.m_renderer = nullptr;
     }
@@ -170,7 +173,8 @@ namespace tgui
             m_fontCached           = other.m_fontCached;
             m_opacityCached        = other.m_opacityCached;
 
-            m_renderer->subscribe(this, [this](const std::string& property){ rendererChangedCallback(property); });
+            m_renderer->subscribe(this, [this](const std::string& property){ rendererChangedCallback(property); },
+                                  [this](const std::set<std::string>& properties){ rendererChangedCallback(properties); });
         }
 
         return *this;
@@ -212,7 +216,8 @@ namespace tgui
             m_fontCached           = std::move(other.m_fontCached);
             m_opacityCached        = std::move(other.m_opacityCached);
 
-            m_renderer->subscribe(this, [this](const std::string& property){ rendererChangedCallback(property); });
+            m_renderer->subscribe(this, [this](const std::string& property){ rendererChangedCallback(property); },
+                                  [this](const std::set<std::string>& properties){ rendererChangedCallback(properties); });
 
             other.m_renderer = nullptr;
         }
@@ -222,54 +227,34 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::setRenderer(const std::shared_ptr<RendererData>& rendererData)
+    void Widget::setRenderer(std::shared_ptr<RendererData> rendererData)
     {
-        std::shared_ptr<RendererData> oldData = m_renderer->getData();
+        // Remember the old properties, as they have to be reset to their default value when the new data doesn't contain them
+        std::set<std::string> changedProperties;
+        for (const auto& pair : m_renderer->getPropertyValuePairs())
+            changedProperties.insert(changedProperties.end(), pair.first);
 
         // If no font is given then try to use the one from the parent
         if (m_parent && m_parent->getRenderer()->getFont() && (rendererData->propertyValuePairs.find("font") == rendererData->propertyValuePairs.end()))
+        {
+            // Shared default data may not be altered, the font is added to a copy of it instead
+            if (rendererData->copyOnWrite)
+                rendererData = RendererData::create(rendererData->propertyValuePairs);
+
             rendererData->propertyValuePairs["font"] = ObjectConverter(m_parent->getRenderer()->getFont());
+        }
 
         // Update the data
         m_renderer->unsubscribe(this);
         m_renderer->setData(rendererData);
-        m_renderer->subscribe(this, [this](const std::string& property){ rendererChangedCallback(property); });
+        m_renderer->subscribe(this, [this](const std::string& property){ rendererChangedCallback(property); },
+                              [this](const std::set<std::string>& properties){ rendererChangedCallback(properties); });
 
         // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value
-        auto oldIt = oldData->propertyValuePairs.begin();
-        auto newIt = rendererData->propertyValuePairs.begin();
-        while (oldIt != oldData->propertyValuePairs.end() && newIt != rendererData->propertyValuePairs.end())
-        {
-            if (oldIt->first < newIt->first)
-            {
-                // Update values that no longer exist in the new renderer and are now reset to the default value
-                rendererChanged(oldIt->first);
-                ++oldIt;
-            }
-            else
-            {
-                // Update changed and new properties
-                rendererChanged(newIt->first);
+        for (const auto& pair : rendererData->propertyValuePairs)
+            changedProperties.insert(pair.first);
 
-                if (newIt->first < oldIt->first)
-                    ++newIt;
-                else
-                {
-                    ++oldIt;
-                    ++newIt;
-                }
-            }
-        }
-        while (oldIt != oldData->propertyValuePairs.end())
-        {
-            rendererChanged(oldIt->first);
-            ++oldIt;
-        }
-        while (newIt != rendererData->propertyValuePairs.end())
-        {
-            rendererChanged(newIt->first);
-            ++newIt;
-        }
+        rendererPropertiesChanged(changedProperties);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -695,6 +680,54 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::rendererPropertiesChanged(const std::set<std::string>& properties)
+    {
+        m_rendererUpdateInProgress = true;
+        try
+        {
+            for (const auto& property : properties)
+                rendererChanged(property);
+        }
+        catch (...)
+        {
+            // The properties that were already set still have to be applied
+            m_rendererUpdateInProgress = false;
+            if (m_rendererUpdatePostponed)
+            {
+                m_rendererUpdatePostponed = false;
+                updateAfterRendererChanges();
+            }
+
+            throw;
+        }
+
+        m_rendererUpdateInProgress = false;
+        if (m_rendererUpdatePostponed)
+        {
+            m_rendererUpdatePostponed = false;
+            updateAfterRendererChanges();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::postponeDuringRendererUpdate()
+    {
+        if (!m_rendererUpdateInProgress)
+            return false;
+
+        m_rendererUpdatePostponed = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::updateAfterRendererChanges()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::mouseEnteredWidget()
     {
         m_mouseHover = true;
@@ -718,6 +751,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::rendererChangedCallback(const std::set<std::string>& properties)
+    {
+        rendererPropertiesChanged(properties);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::drawRectangleShape(sf::RenderTarget& target,
                                     const sf::RenderStates& states,
                                     sf::Vector2f size,
@@ -0,0 +1,83 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/WidgetPrototype.hpp>
+#include <TGUI/Container.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    WidgetPrototype::WidgetPrototype(const Widget::ConstPtr& widget) :
+        m_widget{widget->clone()}
+    {
+        shareRenderers(*m_widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr WidgetPrototype::instantiate() const
+    {
+        if (m_widget)
+            return m_widget->clone();
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::ConstPtr WidgetPrototype::getWidget() const
+    {
+        return m_widget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetPrototype::shareRenderers(Widget& widget)
+    {
+        // The copy-on-write data gets its own copy of nested renderers, so that the prototype no longer shares anything with
+        // the widget it was created from. The instances will share the data with the prototype, without subscribing to it.
+        auto data = RendererData::createCopyOnWrite(widget.getRenderer()->getPropertyValuePairs());
+        for (auto& pair : data->propertyValuePairs)
+        {
+            if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                pair.second = {RendererData::create(pair.second.getRenderer()->propertyValuePairs)};
+        }
+
+        widget.setRenderer(data);
+        widget.m_renderer->m_ownsSharedData = true;
+
+        if (widget.m_containerWidget)
+        {
+            for (const auto& child : static_cast<Container&>(widget).getWidgets())
+                shareRenderers(*child);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
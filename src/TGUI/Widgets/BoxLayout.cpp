@@ -108,6 +108,7 @@ namespace tgui
 
     Widget::Ptr BoxLayout::get(std::size_t index) const
     {
+        loadLazyChildren();
         if (index < m_widgets.size())
             return m_widgets[index];
         else
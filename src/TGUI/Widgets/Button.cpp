@@ -29,7 +29,7 @@
 
 namespace tgui
 {
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"borders", Borders{2}},
                 {"bordercolor", Color{60, 60, 60}},
@@ -42,7 +42,7 @@ namespace tgui
                 {"backgroundcolorhover", sf::Color::White},
                 {"backgroundcolordown", sf::Color::White}
                 ///TODO: Define default disabled colors
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -51,7 +51,7 @@ namespace tgui
         m_type = "Button";
 
         m_renderer = aurora::makeCopied<ButtonRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         setSize(120, 30);
     }
@@ -32,13 +32,13 @@
 
 namespace tgui
 {
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"borders", Borders{2}},
                 {"padding", Padding{2, 0, 0, 0}},
                 {"bordercolor", sf::Color::Black},
                 {"backgroundcolor", Color{245, 245, 245}}
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -48,7 +48,7 @@ namespace tgui
         m_draggableWidget = true;
 
         m_renderer = aurora::makeCopied<ChatBoxRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         setSize({200, 126});
         setTextSize(m_textSize);
@@ -120,6 +120,20 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChatBox::addLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const Font& font)
+    {
+        addLine(text, StyledSpans{text.getSize()}, color, textSize, font);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::addLine(const sf::String& text, const StyledSpans& styles)
+    {
+        addLine(text, styles, m_textColor, m_textSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::addLine(const sf::String& text, const StyledSpans& styles, const sf::Color& color, unsigned int textSize, const Font& font)
     {
         // Remove the oldest line if you exceed the maximum
         if ((m_maxLines > 0) && (m_maxLines == m_lines.size()))
@@ -132,20 +146,34 @@ namespace tgui
 
         Line line;
         line.string = text;
-        line.text.setColor(color);
-        line.text.setOpacity(m_opacityCached);
-        line.text.setCharacterSize(textSize);
-        line.text.setString(text);
-        line.text.setFont(font != nullptr ? font : m_fontCached);
+        line.styles = styles;
+        line.color = color;
+        line.textSize = textSize;
+        line.font = (font != nullptr) ? font : m_fontCached;
+
+        // The styles have to cover exactly the characters of the text
+        if (line.styles.getLength() < text.getSize())
+            line.styles.append(text.getSize() - line.styles.getLength());
+        else if (line.styles.getLength() > text.getSize())
+            line.styles.erase(text.getSize(), line.styles.getLength() - text.getSize());
 
         recalculateLineText(line);
 
+        // Only the height of the new line has to be added, so that adding a line doesn't depend on the amount of lines
+        m_fullTextHeight += line.height;
+
         if (m_newLinesBelowOthers)
             m_lines.push_back(std::move(line));
         else
+        {
+            // The lines that have vertices keep them, they just moved down by one line
+            m_firstVertexLine++;
+            m_lastVertexLine++;
+            m_firstVertexLineTop += line.height;
             m_lines.push_front(std::move(line));
+        }
 
-        recalculateFullTextHeight();
+        updateScrollbarMaximum();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -166,7 +194,7 @@ namespace tgui
     {
         if (lineIndex < m_lines.size())
         {
-            return m_lines[lineIndex].text.getColor();
+            return m_lines[lineIndex].color;
         }
         else // Index too high
             return m_textColor;
@@ -178,7 +206,7 @@ namespace tgui
     {
         if (lineIndex < m_lines.size())
         {
-            return m_lines[lineIndex].text.getCharacterSize();
+            return m_lines[lineIndex].textSize;
         }
         else // Index too high
             return m_textSize;
@@ -190,7 +218,7 @@ namespace tgui
     {
         if (lineIndex < m_lines.size())
         {
-            return m_lines[lineIndex].text.getFont();
+            return m_lines[lineIndex].font;
         }
         else // Index too high
             return m_fontCached;
@@ -198,13 +226,40 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    StyledSpans ChatBox::getLineStyles(std::size_t lineIndex) const
+    {
+        if (lineIndex < m_lines.size())
+        {
+            return m_lines[lineIndex].styles;
+        }
+        else // Index too high
+            return StyledSpans{};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ChatBox::removeLine(std::size_t lineIndex)
     {
         if (lineIndex < m_lines.size())
         {
+            // The vertices are relative to their line, so the other lines only have to move instead of being searched again
+            if (lineIndex < m_firstVertexLine)
+            {
+                m_firstVertexLine--;
+                m_lastVertexLine--;
+                m_firstVertexLineTop -= m_lines[lineIndex].height;
+            }
+            else if (lineIndex < m_lastVertexLine)
+                m_lastVertexLine--;
+
+            m_fullTextHeight -= m_lines[lineIndex].height;
             m_lines.erase(m_lines.begin() + lineIndex);
 
-            recalculateFullTextHeight();
+            // Don't let rounding errors accumulate when there is nothing left
+            if (m_lines.empty())
+                m_fullTextHeight = 0;
+
+            updateScrollbarMaximum();
             return true;
         }
         else // Index too high
@@ -385,14 +440,51 @@ namespace tgui
 
     void ChatBox::recalculateLineText(Line& line)
     {
-        line.text.setString("");
+        line.lineBreaks.clear();
+        line.verticesValid = false;
+
+        if (line.font == nullptr)
+        {
+            line.height = 0;
+            return;
+        }
 
         // Find the maximum width of one line
         const float maxWidth = getInnerSize().x - m_scroll.getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
-        if (maxWidth < 0)
+        if (maxWidth >= 0)
+            line.lineBreaks = Text::findLineBreaks(maxWidth, line.string, line.font, line.textSize, false, false);
+
+        line.height = (line.lineBreaks.size() + 1) * line.font.getLineSpacing(line.textSize)
+                      + Text::calculateExtraVerticalSpace(line.font, line.textSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::updateLineVertices(const Line& line) const
+    {
+        line.vertices.clear();
+        line.verticesValid = true;
+
+        if (line.font == nullptr)
             return;
 
-        line.text.setString(Text::wordWrap(maxWidth, line.string, line.text.getFont(), line.text.getCharacterSize(), false));
+        const float lineSpacing = line.font.getLineSpacing(line.textSize);
+
+        std::size_t rowStart = 0;
+        for (std::size_t row = 0; row <= line.lineBreaks.size(); ++row)
+        {
+            const std::size_t rowEnd = (row < line.lineBreaks.size()) ? line.lineBreaks[row] : line.string.getSize();
+
+            // A newline character remains at the end of its row but it isn't drawn
+            std::size_t rowLength = rowEnd - rowStart;
+            if ((rowLength > 0) && (line.string[rowEnd - 1] == '\n'))
+                rowLength--;
+
+            line.styles.appendGlyphs(line.vertices, line.font, line.textSize, line.string, rowStart, rowLength,
+                                     {0, row * lineSpacing}, line.color, m_opacityCached);
+
+            rowStart = rowEnd;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -409,10 +501,19 @@ namespace tgui
 
     void ChatBox::recalculateFullTextHeight()
     {
+        m_vertexLinesOutdated = true;
+
         m_fullTextHeight = 0;
         for (const auto& line : m_lines)
-            m_fullTextHeight += line.text.getSize().y;
+            m_fullTextHeight += line.height;
 
+        updateScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::updateScrollbarMaximum()
+    {
         // Update the maximum of the scrollbar
         const unsigned int oldMaximum = m_scroll.getMaximum();
         m_scroll.setMaximum(static_cast<unsigned int>(m_fullTextHeight));
@@ -476,7 +577,7 @@ namespace tgui
             m_scroll.getRenderer()->setOpacity(m_opacityCached);
 
             for (auto& line : m_lines)
-                line.text.setOpacity(m_opacityCached);
+                line.verticesValid = false;
         }
         else if (property == "font")
         {
@@ -488,9 +589,9 @@ namespace tgui
                 bool lineChanged = false;
                 for (auto& line : m_lines)
                 {
-                    if (line.text.getFont() == nullptr)
+                    if (line.font == nullptr)
                     {
-                        line.text.setFont(m_fontCached);
+                        line.font = m_fontCached;
                         lineChanged = true;
                     }
                 }
@@ -540,17 +641,78 @@ namespace tgui
         // Set the clipping for all draw calls that happen until this clipping object goes out of scope
         const Clipping clipping{target, states, {}, {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - m_scroll.getSize().x, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()}};
 
-        states.transform.translate({0, -static_cast<float>(m_scroll.getValue())});
+        const float scrollValue = static_cast<float>(m_scroll.getValue());
+        const float visibleHeight = getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+        states.transform.translate({0, -scrollValue});
 
         // Put the lines at the bottom of the chat box if needed
-        if (!m_linesStartFromTop && (m_fullTextHeight < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
-            states.transform.translate(0, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - m_fullTextHeight);
+        float lineTop = 0;
+        if (!m_linesStartFromTop && (m_fullTextHeight < visibleHeight))
+            lineTop = visibleHeight - m_fullTextHeight;
 
-        for (const auto& line : m_lines)
+        const auto releaseVertices = [](const Line& line)
+            {
+                std::vector<sf::Vertex>().swap(line.vertices);
+                line.verticesValid = false;
+            };
+
+        if (m_vertexLinesOutdated)
         {
-            line.text.draw(target, states);
-            states.transform.translate(0, line.text.getSize().y);
+            for (const auto& line : m_lines)
+            {
+                if (!line.vertices.empty())
+                    releaseVertices(line);
+            }
+
+            m_firstVertexLine = 0;
+            m_lastVertexLine = 0;
+            m_firstVertexLineTop = 0;
+            m_vertexLinesOutdated = false;
+        }
+
+        // Find the first visible line, starting from the first line that was visible when the chat box was drawn before
+        std::size_t firstLine = std::min(m_firstVertexLine, m_lines.size());
+        float firstLineTop = m_firstVertexLineTop;
+        while ((firstLine > 0) && (lineTop + firstLineTop > scrollValue))
+        {
+            --firstLine;
+            firstLineTop -= m_lines[firstLine].height;
+        }
+        if (firstLine == 0)
+            firstLineTop = 0;
+
+        while ((firstLine < m_lines.size()) && (lineTop + firstLineTop + m_lines[firstLine].height <= scrollValue))
+        {
+            firstLineTop += m_lines[firstLine].height;
+            ++firstLine;
         }
+
+        // Only the visible lines are drawn, the vertices of the other lines are released so that long logs don't use much memory
+        std::size_t lastLine = firstLine;
+        lineTop += firstLineTop;
+        while ((lastLine < m_lines.size()) && (lineTop < scrollValue + visibleHeight))
+        {
+            const Line& line = m_lines[lastLine];
+            if (!line.verticesValid)
+                updateLineVertices(line);
+
+            sf::RenderStates lineStates = states;
+            lineStates.transform.translate(0, lineTop);
+            Text::drawGlyphs(target, lineStates, line.vertices.data(), line.vertices.size(), line.font, line.textSize);
+
+            lineTop += line.height;
+            ++lastLine;
+        }
+
+        for (std::size_t i = m_firstVertexLine; i < std::min(m_lastVertexLine, m_lines.size()); ++i)
+        {
+            if (((i < firstLine) || (i >= lastLine)) && !m_lines[i].vertices.empty())
+                releaseVertices(m_lines[i]);
+        }
+
+        m_firstVertexLine = firstLine;
+        m_lastVertexLine = lastLine;
+        m_firstVertexLineTop = firstLineTop;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
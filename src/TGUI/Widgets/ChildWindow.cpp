@@ -50,7 +50,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"borders", Borders{1}},
                 {"bordercolor", sf::Color::Black},
@@ -59,7 +59,7 @@ namespace tgui
                 {"backgroundcolor", Color{230, 230, 230}},
                 {"distancetoside", 3.f},
                 {"paddingbetweenbuttons", 1.f}
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -68,7 +68,7 @@ namespace tgui
         m_type = "ChildWindow";
 
         m_renderer = aurora::makeCopied<ChildWindowRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         getRenderer()->getCloseButton()->propertyValuePairs["borders"] = {Borders{1}};
         getRenderer()->getMaximizeButton()->propertyValuePairs["borders"] = {Borders{1}};
@@ -722,7 +722,7 @@ namespace tgui
             for (auto& button : {m_closeButton, m_minimizeButton, m_maximizeButton})
             {
                 if (button)
-                    button->getRenderer()->setFont(m_fontCached);
+                    button->getRenderer()->inheritFont(m_fontCached);
             }
 
             m_titleText.setFont(m_fontCached);
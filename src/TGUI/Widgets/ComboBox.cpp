@@ -32,7 +32,7 @@
 
 namespace tgui
 {
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"borders", Borders{2}},
                 {"padding", Padding{0}},
@@ -43,7 +43,7 @@ namespace tgui
                 {"arrowcolorhover", sf::Color::Black},
                 {"arrowbackgroundcolor", Color{245, 245, 245}},
                 {"arrowbackgroundcolorhover", sf::Color::White}
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -56,7 +56,7 @@ namespace tgui
         initListBox();
 
         m_renderer = aurora::makeCopied<ComboBoxRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         setSize({150, 24});
     }
@@ -606,7 +606,7 @@ namespace tgui
             m_text.setFont(m_fontCached);
 
             if (m_listBox->getRenderer()->getFont() == nullptr)
-                m_listBox->getRenderer()->setFont(m_fontCached);
+                m_listBox->getRenderer()->inheritFont(m_fontCached);
 
             updateSize();
         }
@@ -43,7 +43,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"borders", Borders{2}},
                 {"padding", Padding{4, 2, 4, 2}},
@@ -58,7 +58,7 @@ namespace tgui
                 {"backgroundcolor", Color{245, 245, 245}},
                 {"backgroundcolorhover", sf::Color::White}
                 ///TODO: Define default disabled colors
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -70,7 +70,7 @@ namespace tgui
         m_allowFocus = true;
 
         m_renderer = aurora::makeCopied<EditBoxRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         setSize({240, 30});
     }
@@ -163,13 +163,15 @@ namespace tgui
         }
 
         // Change the text if allowed
-        if (m_regexString == ".*")
+        if ((m_regexString == ".*") || (m_inputValidator.isCompiled() && m_inputValidator.match(text)))
             m_text = text;
-        else if (std::regex_match(text.toAnsiString(), m_regex))
-            m_text = text.toAnsiString(); // Unicode is not supported when using regex because it can't be checked
+        else if (!m_inputValidator.isCompiled() && m_inputValidator.match(text))
+            m_text = text.toAnsiString(); // Unicode is not supported when falling back to std::regex because it can't be checked
         else // Clear the text
             m_text = "";
 
+        invalidateValidatorStates(0);
+
         // Remove all the excess characters if there is a character limit
         if ((m_maxChars > 0) && (m_text.getSize() > m_maxChars))
             m_text.erase(m_maxChars, sf::String::InvalidPos);
@@ -323,6 +325,7 @@ namespace tgui
             // Remove all the excess characters
             m_text.erase(m_maxChars, sf::String::InvalidPos);
             displayedText.erase(m_maxChars, sf::String::InvalidPos);
+            invalidateValidatorStates(m_maxChars);
 
             // If we passed here then the text has changed.
             m_textBeforeSelection.setString(displayedText);
@@ -379,6 +382,7 @@ namespace tgui
                 m_text.erase(m_text.getSize()-1);
             }
 
+            invalidateValidatorStates(m_text.getSize());
             m_textBeforeSelection.setString(m_textFull.getString());
 
             // There is no clipping
@@ -462,7 +466,7 @@ namespace tgui
     void EditBox::setInputValidator(const std::string& regex)
     {
         m_regexString = regex;
-        m_regex = m_regexString;
+        m_inputValidator = InputValidator{m_regexString};
 
         setText(m_text);
     }
@@ -726,6 +730,7 @@ namespace tgui
                 displayedString.erase(m_selEnd-1, 1);
                 m_textFull.setString(displayedString);
                 m_text.erase(m_selEnd-1, 1);
+                invalidateValidatorStates(m_selEnd-1);
 
                 // Set the caret back on the correct position
                 setCaretPosition(m_selEnd - 1);
@@ -770,6 +775,7 @@ namespace tgui
                 displayedString.erase(m_selEnd, 1);
                 m_textFull.setString(displayedString);
                 m_text.erase(m_selEnd, 1);
+                invalidateValidatorStates(m_selEnd);
 
                 // Set the caret back on the correct position
                 setCaretPosition(m_selEnd);
@@ -856,12 +862,22 @@ namespace tgui
         // Only add the character when the regex matches
         if (m_regexString != ".*")
         {
-            sf::String text = m_text;
-            text.insert(m_selEnd, key);
+            if (m_inputValidator.isCompiled())
+            {
+                // Continue from the state before the caret, so only the characters behind the caret have to be checked again
+                const auto state = m_inputValidator.getNextState(getValidatorState(m_selEnd), key);
+                if (!m_inputValidator.isAccepting(m_inputValidator.getNextState(state, m_text, m_selEnd)))
+                    return;
+            }
+            else
+            {
+                sf::String text = m_text;
+                text.insert(m_selEnd, key);
 
-            // The character has to match the regex
-            if (!std::regex_match(text.toAnsiString(), m_regex))
-                return;
+                // The character has to match the regex
+                if (!m_inputValidator.match(text))
+                    return;
+            }
         }
 
         // If there are selected characters then delete them first
@@ -874,6 +890,7 @@ namespace tgui
 
         // Insert our character
         m_text.insert(m_selEnd, key);
+        invalidateValidatorStates(m_selEnd);
 
         // Change the displayed text
         sf::String displayedText = m_textFull.getString();
@@ -1146,11 +1163,11 @@ namespace tgui
                 continue;
             }
             else if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', textSize, bold).advance) * 4;
+                charWidth = m_fontCached.getGlyphAdvance(' ', textSize, bold) * 4;
             else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, textSize, bold).advance);
+                charWidth = m_fontCached.getGlyphAdvance(curChar, textSize, bold);
 
-            const float kerning = static_cast<float>(m_fontCached.getKerning(prevChar, curChar, textSize));
+            const float kerning = m_fontCached.getKerning(prevChar, curChar, textSize);
             if (width + charWidth < posX)
                 width += charWidth + kerning;
             else
@@ -1183,6 +1200,7 @@ namespace tgui
         displayedString.erase(pos, m_selChars);
         m_textFull.setString(displayedString);
         m_text.erase(pos, m_selChars);
+        invalidateValidatorStates(pos);
 
         // Set the caret back on the correct position
         setCaretPosition(pos);
@@ -1201,6 +1219,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    InputValidator::State EditBox::getValidatorState(std::size_t length)
+    {
+        if (m_validatorStates.empty())
+            m_validatorStates.push_back(m_inputValidator.getStartState());
+
+        while (m_validatorStates.size() <= length)
+        {
+            const std::size_t index = m_validatorStates.size() - 1;
+            m_validatorStates.push_back(m_inputValidator.getNextState(m_validatorStates.back(), m_text[index]));
+        }
+
+        return m_validatorStates[length];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::invalidateValidatorStates(std::size_t length)
+    {
+        if (m_validatorStates.size() > length + 1)
+            m_validatorStates.resize(length + 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::recalculateTextPositions()
     {
         float textX = m_paddingCached.getLeft() - m_textCropPosition;
@@ -38,14 +38,14 @@ namespace
 
 namespace tgui
 {
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"borders", Borders{5}},
                 {"imagerotation", 0.f},
                 {"bordercolor", sf::Color::Black},
                 {"thumbcolor", sf::Color::Black},
                 {"backgroundcolor", sf::Color::White}
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -55,7 +55,7 @@ namespace tgui
         m_draggableWidget = true;
 
         m_renderer = aurora::makeCopied<KnobRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         setSize(140, 140);
     }
@@ -32,13 +32,13 @@
 
 namespace tgui
 {
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"borders", Borders{}},
                 {"bordercolor", Color{60, 60, 60}},
                 {"textcolor", Color{60, 60, 60}},
                 {"backgroundcolor", sf::Color::Transparent}
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -47,7 +47,7 @@ namespace tgui
         m_type = "Label";
 
         m_renderer = aurora::makeCopied<LabelRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -255,8 +255,7 @@ namespace tgui
         else if (property == "textcolor")
         {
             m_textColorCached = getRenderer()->getTextColor();
-            for (auto& line : m_lines)
-                line.setColor(m_textColorCached);
+            m_textLayout.setColor(m_textColorCached);
         }
         else if (property == "bordercolor")
         {
@@ -274,9 +273,7 @@ namespace tgui
         else if (property == "opacity")
         {
             Widget::rendererChanged(property);
-
-            for (auto& line : m_lines)
-                line.setOpacity(m_opacityCached);
+            m_textLayout.setOpacity(m_opacityCached);
         }
         else
             Widget::rendererChanged(property);
@@ -284,6 +281,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Label::updateAfterRendererChanges()
+    {
+        rearrangeText();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::update(sf::Time elapsedTime)
     {
         Widget::update(elapsedTime);
@@ -300,6 +304,9 @@ namespace tgui
 
     void Label::rearrangeText()
     {
+        if (postponeDuringRendererUpdate())
+            return;
+
         if (m_fontCached == nullptr)
             return;
 
@@ -315,35 +322,12 @@ namespace tgui
                 return;
         }
 
-        // Fit the text in the available space
-        const sf::String string = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSize, m_textStyleCached & sf::Text::Bold);
-
-        // Split the string in multiple lines
-        m_lines.clear();
-        float width = 0;
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != sf::String::InvalidPos)
-        {
-            newLinePos = string.find('\n', searchPosStart);
-
-            m_lines.emplace_back();
-            m_lines.back().setCharacterSize(getTextSize());
-            m_lines.back().setFont(m_fontCached);
-            m_lines.back().setStyle(m_textStyleCached);
-            m_lines.back().setColor(m_textColorCached);
-            m_lines.back().setOpacity(m_opacityCached);
-
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.back().setString(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.back().setString(string.substring(searchPosStart));
-
-            if (m_lines.back().getSize().x > width)
-                width = m_lines.back().getSize().x;
-
-            searchPosStart = newLinePos + 1;
-        }
+        // Fit the text in the available space. The layout only splits the text again when one of these properties changed.
+        m_textLayout.setFont(m_fontCached);
+        m_textLayout.setCharacterSize(getTextSize());
+        m_textLayout.setStyle(m_textStyleCached);
+        m_textLayout.setMaximumWidth(maxWidth);
+        m_textLayout.setString(m_string);
 
         const Outline outline = {m_paddingCached.getLeft() + m_bordersCached.getLeft(),
                                  m_paddingCached.getTop() + m_bordersCached.getTop(),
@@ -353,14 +337,15 @@ namespace tgui
         // Update the size of the label
         if (m_autoSize)
         {
-            Widget::setSize({std::max(width, maxWidth) + outline.getLeft() + outline.getRight(),
-                            (std::max<std::size_t>(m_lines.size(), 1) * m_fontCached.getLineSpacing(m_textSize)) + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize, m_textStyleCached) + outline.getTop() + outline.getBottom()});
+            const sf::Vector2f textSize = m_textLayout.getSize();
+            Widget::setSize({std::max(textSize.x, maxWidth) + outline.getLeft() + outline.getRight(),
+                             textSize.y + outline.getTop() + outline.getBottom()});
 
             m_bordersCached.updateParentSize(getSize());
             m_paddingCached.updateParentSize(getSize());
         }
 
-        // Update the line positions
+        // Update the text position
         {
             if ((getSize().x <= outline.getLeft() + outline.getRight()) || (getSize().y <= outline.getTop() + outline.getBottom()))
                 return;
@@ -370,7 +355,7 @@ namespace tgui
             if (m_verticalAlignment != VerticalAlignment::Top)
             {
                 const float totalHeight = getSize().y - outline.getTop() - outline.getBottom();
-                const float totalTextHeight = m_lines.size() * m_fontCached.getLineSpacing(m_textSize);
+                const float totalTextHeight = m_textLayout.getLineCount() * m_fontCached.getLineSpacing(m_textSize);
 
                 if (m_verticalAlignment == VerticalAlignment::Center)
                     pos.y += (totalHeight - totalTextHeight) / 2.f;
@@ -378,37 +363,15 @@ namespace tgui
                     pos.y += totalHeight - totalTextHeight;
             }
 
-            if (m_horizontalAlignment == HorizontalAlignment::Left)
-            {
-                const float lineSpacing = m_fontCached.getLineSpacing(m_textSize);
-                for (auto& line : m_lines)
-                {
-                    line.setPosition(pos.x, pos.y);
-                    pos.y += lineSpacing;
-                }
-            }
-            else // Center or Right alignment
-            {
-                const float totalWidth = getSize().x - outline.getLeft() - outline.getRight();
+            m_textLayout.setPosition(pos);
 
-                for (auto& line : m_lines)
-                {
-                    line.setPosition(0, 0);
-
-                    std::size_t lastChar = line.getString().getSize();
-                    while (lastChar > 0 && isWhitespace(line.getString()[lastChar-1]))
-                        lastChar--;
-
-                    const float textWidth = line.findCharacterPos(lastChar).x;
-
-                    if (m_horizontalAlignment == HorizontalAlignment::Center)
-                        line.setPosition(pos.x + ((totalWidth - textWidth) / 2.f), pos.y);
-                    else if (m_horizontalAlignment == HorizontalAlignment::Right)
-                        line.setPosition(pos.x + totalWidth - textWidth, pos.y);
-
-                    pos.y += m_fontCached.getLineSpacing(m_textSize);
-                }
-            }
+            const float totalWidth = getSize().x - outline.getLeft() - outline.getRight();
+            if (m_horizontalAlignment == HorizontalAlignment::Center)
+                m_textLayout.setAlignment(TextLayout::Alignment::Center, totalWidth);
+            else if (m_horizontalAlignment == HorizontalAlignment::Right)
+                m_textLayout.setAlignment(TextLayout::Alignment::Right, totalWidth);
+            else
+                m_textLayout.setAlignment(TextLayout::Alignment::Left, totalWidth);
         }
     }
 
@@ -443,8 +406,7 @@ namespace tgui
         }
 
         // Draw the text
-        for (const auto& line : m_lines)
-            line.draw(target, states);
+        m_textLayout.draw(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,7 +30,7 @@
 
 namespace tgui
 {
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"borders", Borders{2}},
                 {"padding", Padding{0}},
@@ -42,7 +42,7 @@ namespace tgui
                 {"backgroundcolorhover", sf::Color::White},
                 {"selectedbackgroundcolor", Color{0, 110, 255}},
                 {"selectedbackgroundcolorhover", Color{30, 150, 255}}
-            };
+            });
 
    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -53,7 +53,7 @@ namespace tgui
         m_draggableWidget = true;
 
         m_renderer = aurora::makeCopied<ListBoxRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         setSize({150, 154});
         setItemHeight(m_itemHeight);
@@ -31,14 +31,14 @@
 
 namespace tgui
 {
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"textcolor", sf::Color::Black},
                 {"selectedtextcolor", sf::Color::White},
                 {"backgroundcolor", sf::Color::White},
                 {"selectedbackgroundcolor", Color{0, 110, 255}},
                 {"distancetoside", 4.f}
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -47,7 +47,7 @@ namespace tgui
         m_type = "MenuBar";
 
         m_renderer = aurora::makeCopied<MenuBarRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         setSize({0, 20});
     }
@@ -30,7 +30,7 @@
 
 namespace tgui
 {
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"borders", Borders{1}},
                 {"bordercolor", sf::Color::Black},
@@ -40,7 +40,7 @@ namespace tgui
                 {"distancetoside", 3.f},
                 {"paddingbetweenbuttons", 1.f},
                 {"textcolor", sf::Color::Black}
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -49,7 +49,7 @@ namespace tgui
         m_type = "MessageBox";
 
         m_renderer = aurora::makeCopied<MessageBoxRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         getRenderer()->getCloseButton()->propertyValuePairs["borders"] = {Borders{1}};
         getRenderer()->getMaximizeButton()->propertyValuePairs["borders"] = {Borders{1}};
@@ -246,7 +246,7 @@ namespace tgui
 
             for (const auto& button : m_buttons)
             {
-                const float width = sf::Text(button->getText(), *m_fontCached.getFont(), m_textSize).getLocalBounds().width;
+                const float width = Text::getLineWidth(button->getText(), m_fontCached, m_textSize);
                 if (buttonWidth < width * 10.0f / 9.0f)
                     buttonWidth = width * 10.0f / 9.0f;
             }
@@ -316,7 +316,7 @@ namespace tgui
             m_label->getRenderer()->setFont(m_fontCached);
 
             for (auto& button : m_buttons)
-                button->getRenderer()->setFont(m_fontCached);
+                button->getRenderer()->inheritFont(m_fontCached);
 
             rearrange();
         }
@@ -30,11 +30,11 @@
 
 namespace tgui
 {
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"bordercolor", sf::Color::Black},
                 {"backgroundcolor", sf::Color::Transparent}
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -43,7 +43,7 @@ namespace tgui
         m_type = "Panel";
 
         m_renderer = aurora::makeCopied<PanelRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         setSize(size);
     }
@@ -30,7 +30,7 @@
 
 namespace tgui
 {
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"borders", Borders{2}},
                 {"bordercolor", sf::Color::Black},
@@ -38,7 +38,7 @@ namespace tgui
                 {"textcolorfilled", sf::Color::White},
                 {"backgroundcolor", Color{245, 245, 245}},
                 {"fillcolor", Color{0, 110, 255}}
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -47,7 +47,7 @@ namespace tgui
         m_type = "ProgressBar";
 
         m_renderer = aurora::makeCopied<ProgressBarRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         setSize(160, 20);
     }
@@ -29,7 +29,7 @@
 
 namespace tgui
 {
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"borders", Borders{3}},
                 {"bordercolor", Color{60, 60, 60}},
@@ -42,7 +42,7 @@ namespace tgui
                 {"checkcolorhover", sf::Color::Black},
                 {"textdistanceratio", 0.2f}
                 ///TODO: Define default disabled colors
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -51,7 +51,7 @@ namespace tgui
         m_type = "RadioButton";
 
         m_renderer = aurora::makeCopied<RadioButtonRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         setSize({24, 24});
     }
@@ -30,7 +30,7 @@
 
 namespace tgui
 {
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"trackcolor", Color{245, 245, 245}},
                 {"thumbcolor", Color{220, 220, 220}},
@@ -39,7 +39,7 @@ namespace tgui
                 {"arrowbackgroundcolorhover", Color{255, 255, 255}},
                 {"arrowcolor", Color{60, 60, 60}},
                 {"arrowcolorhover", Color{0, 0, 0}}
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -50,7 +50,7 @@ namespace tgui
         m_draggableWidget = true;
 
         m_renderer = aurora::makeCopied<ScrollbarRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         setSize(16, 160);
     }
@@ -29,7 +29,7 @@
 
 namespace tgui
 {
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"borders", Borders{2}},
                 {"bordercolor", Color{60, 60, 60}},
@@ -38,7 +38,7 @@ namespace tgui
                 {"trackcolorhover", Color{255, 255, 255}},
                 {"thumbcolor", Color{245, 245, 245}},
                 {"thumbcolorhover", Color{255, 255, 255}}
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -49,7 +49,7 @@ namespace tgui
         m_draggableWidget = true;
 
         m_renderer = aurora::makeCopied<SliderRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         setSize(200, 16);
     }
@@ -30,7 +30,7 @@
 
 namespace tgui
 {
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"borders", Borders{2}},
                 {"bordercolor", sf::Color::Black},
@@ -39,7 +39,7 @@ namespace tgui
                 {"arrowcolor", Color{60, 60, 60}},
                 {"arrowcolorhover", sf::Color::Black},
                 {"spacebetweenarrows", 2.f}
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -48,7 +48,7 @@ namespace tgui
         m_type = "SpinButton";
 
         m_renderer = aurora::makeCopied<SpinButtonRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         setSize(20, 42);
     }
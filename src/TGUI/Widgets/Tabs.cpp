@@ -30,7 +30,7 @@
 
 namespace tgui
 {
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"borders", Borders{2}},
                 {"bordercolor", sf::Color::Black},
@@ -42,7 +42,7 @@ namespace tgui
                 {"selectedbackgroundcolor", Color{0, 110, 255}},
                 {"selectedbackgroundcolorhover", Color{30, 150, 255}},
                 {"distancetoside", 1.f}
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -51,7 +51,7 @@ namespace tgui
         m_type = "Tabs";
 
         m_renderer = aurora::makeCopied<TabsRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         setTabHeight(30);
     }
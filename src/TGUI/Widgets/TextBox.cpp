@@ -29,12 +29,13 @@
 #include <TGUI/Clipping.hpp>
 
 #include <cmath>
+#include <iterator>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    static std::map<std::string, ObjectConverter> defaultRendererValues =
+    static const std::shared_ptr<RendererData> defaultRendererData = RendererData::createCopyOnWrite(
             {
                 {"borders", Borders{2}},
                 {"padding", Padding{2, 0, 0, 0}},
@@ -45,7 +46,7 @@ namespace tgui
                 {"selectedtextcolor", sf::Color::White},
                 {"selectedtextbackgroundcolor", Color{0, 110, 255}},
                 {"backgroundcolor", sf::Color::White}
-            };
+            });
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -55,7 +56,7 @@ namespace tgui
         m_draggableWidget = true;
 
         m_renderer = aurora::makeCopied<TextBoxRenderer>();
-        setRenderer(RendererData::create(defaultRendererValues));
+        setRenderer(defaultRendererData);
 
         setSize({360, 189});
     }
@@ -113,6 +114,7 @@ namespace tgui
         else
             m_text = text;
 
+        m_styledSpans = StyledSpans{m_text.getSize()};
         rearrangeText(false);
     }
 
@@ -120,7 +122,42 @@ namespace tgui
 
     void TextBox::addText(const sf::String& text)
     {
-        setText(m_text + text);
+        addText(text, {}, {});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::addText(const sf::String& text, Color color, TextStyle style)
+    {
+        // Only add the characters that still fit when a character limit is set
+        sf::String addedText = text;
+        if ((m_maxChars > 0) && (m_text.getSize() + text.getSize() > m_maxChars))
+            addedText = text.substring(0, m_maxChars - std::min(m_text.getSize(), m_maxChars));
+
+        // Only the last paragraph has to be wrapped again, so that adding to a long log doesn't slow down
+        const std::size_t oldSize = m_text.getSize();
+        m_text += addedText;
+        rearrangeChangedText(oldSize, 0, addedText.getSize());
+        m_styledSpans.setStyle(oldSize, addedText.getSize(), color, style);
+
+        // Place the caret at the back of the text, which also updates the vertices of the visible lines
+        if (!m_linesOutdated)
+            setCaretPosition(m_text.getSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::setSpanStyle(std::size_t start, std::size_t length, Color color, TextStyle style)
+    {
+        m_styledSpans.setStyle(start, length, color, style);
+        updateLineVertices();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const StyledSpans& TextBox::getStyledSpans() const
+    {
+        return m_styledSpans;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -134,7 +171,11 @@ namespace tgui
 
     sf::String TextBox::getSelectedText() const
     {
-        return m_textSelection1.getString() + m_textSelection2.getString();
+        auto selectionPositions = findTextSelectionPositions();
+        if (selectionPositions.first > selectionPositions.second)
+            std::swap(selectionPositions.first, selectionPositions.second);
+
+        return m_text.substring(selectionPositions.first, selectionPositions.second - selectionPositions.first);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -146,13 +187,6 @@ namespace tgui
         if (m_textSize < 1)
             m_textSize = 1;
 
-        // Change the text size
-        m_textBeforeSelection.setCharacterSize(m_textSize);
-        m_textSelection1.setCharacterSize(m_textSize);
-        m_textSelection2.setCharacterSize(m_textSize);
-        m_textAfterSelection1.setCharacterSize(m_textSize);
-        m_textAfterSelection2.setCharacterSize(m_textSize);
-
         // Calculate the height of one line
         m_lineHeight = static_cast<unsigned int>(m_fontCached.getLineSpacing(m_textSize));
 
@@ -180,6 +214,7 @@ namespace tgui
         {
             // Remove all the excess characters
             m_text.erase(m_maxChars, sf::String::InvalidPos);
+            m_styledSpans.erase(m_maxChars, m_styledSpans.getLength());
             rearrangeText(false);
         }
     }
@@ -222,26 +257,13 @@ namespace tgui
         if (charactersBeforeCaret > m_text.getSize())
             charactersBeforeCaret = m_text.getSize();
 
-        // Find the line and position on that line on which the caret is located
-        std::size_t count = 0;
-        for (std::size_t i = 0; i < m_lines.size(); ++i)
-        {
-            if (count + m_lines[i].getSize() < charactersBeforeCaret)
-            {
-                count += m_lines[i].getSize();
-                if ((count < m_text.getSize()) && (m_text[count] == '\n'))
-                    count += 1;
-            }
-            else
-            {
-                m_selStart.y = i;
-                m_selStart.x = charactersBeforeCaret - count;
+        if (m_lines.empty())
+            return;
 
-                m_selEnd = m_selStart;
-                updateSelectionTexts();
-                break;
-            }
-        }
+        // Find the line and position on that line on which the caret is located
+        m_selStart = findLinePosition(charactersBeforeCaret);
+        m_selEnd = m_selStart;
+        updateSelection();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -356,8 +378,8 @@ namespace tgui
                 m_possibleDoubleClick = true;
             }
 
-            // Update the texts
-            updateSelectionTexts();
+            // Update the vertices
+            updateSelection();
 
             // The caret should be visible
             m_caretVisible = true;
@@ -407,7 +429,7 @@ namespace tgui
             if (caretPosition != m_selEnd)
             {
                 m_selEnd = caretPosition;
-                updateSelectionTexts();
+                updateSelection();
             }
 
             // Check if the caret is located above or below the view
@@ -457,7 +479,7 @@ namespace tgui
                 if (!event.shift)
                     m_selStart = m_selEnd;
 
-                updateSelectionTexts();
+                updateSelection();
                 break;
             }
 
@@ -468,7 +490,7 @@ namespace tgui
                 if (!event.shift)
                     m_selStart = m_selEnd;
 
-                updateSelectionTexts();
+                updateSelection();
                 break;
             }
 
@@ -537,7 +559,7 @@ namespace tgui
                 if (!event.shift)
                     m_selStart = m_selEnd;
 
-                updateSelectionTexts();
+                updateSelection();
                 break;
             }
 
@@ -606,7 +628,7 @@ namespace tgui
                 if (!event.shift)
                     m_selStart = m_selEnd;
 
-                updateSelectionTexts();
+                updateSelection();
                 break;
             }
 
@@ -620,7 +642,7 @@ namespace tgui
                 if (!event.shift)
                     m_selStart = m_selEnd;
 
-                updateSelectionTexts();
+                updateSelection();
                 break;
             }
 
@@ -634,7 +656,7 @@ namespace tgui
                 if (!event.shift)
                     m_selStart = m_selEnd;
 
-                updateSelectionTexts();
+                updateSelection();
                 break;
             }
 
@@ -658,7 +680,7 @@ namespace tgui
                 if (!event.shift)
                     m_selStart = m_selEnd;
 
-                updateSelectionTexts();
+                updateSelection();
                 break;
             }
 
@@ -684,7 +706,7 @@ namespace tgui
                 if (!event.shift)
                     m_selStart = m_selEnd;
 
-                updateSelectionTexts();
+                updateSelection();
                 break;
             }
 
@@ -733,7 +755,7 @@ namespace tgui
                         m_selStart = m_selEnd;
 
                         m_text.erase(pos - 1, 1);
-                        rearrangeText(true);
+                        rearrangeChangedText(pos - 1, 1, 0);
                     }
                 }
                 else // When you did select some characters then delete them
@@ -755,8 +777,12 @@ namespace tgui
                 // Check that we did not select any characters
                 if (m_selStart == m_selEnd)
                 {
-                    m_text.erase(findTextSelectionPositions().second, 1);
-                    rearrangeText(true);
+                    const std::size_t pos = findTextSelectionPositions().second;
+                    if (pos < m_text.getSize())
+                    {
+                        m_text.erase(pos, 1);
+                        rearrangeChangedText(pos, 1, 0);
+                    }
                 }
                 else // You did select some characters, so remove them
                     deleteSelectedCharacters();
@@ -771,7 +797,7 @@ namespace tgui
                 {
                     m_selStart = {0, 0};
                     m_selEnd = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
-                    updateSelectionTexts();
+                    updateSelection();
                 }
 
                 break;
@@ -815,12 +841,13 @@ namespace tgui
                     {
                         deleteSelectedCharacters();
 
-                        m_text.insert(findTextSelectionPositions().first, clipboardContents);
+                        const std::size_t pos = findTextSelectionPositions().first;
+                        m_text.insert(pos, clipboardContents);
                         m_lines[m_selStart.y].insert(m_selStart.x, clipboardContents);
 
                         m_selStart.x += clipboardContents.getSize();
                         m_selEnd = m_selStart;
-                        rearrangeText(true);
+                        rearrangeChangedText(pos, 0, clipboardContents.getSize());
 
                         onTextChange.emit(this, m_text);
                     }
@@ -861,7 +888,7 @@ namespace tgui
             m_selStart.x++;
             m_selEnd.x++;
 
-            rearrangeText(true);
+            rearrangeChangedText(caretPosition, 0, 1);
         };
 
         // If there is a scrollbar then inserting can't go wrong
@@ -873,6 +900,7 @@ namespace tgui
         {
             // Store the data so that it can be reverted
             sf::String oldText = m_text;
+            const StyledSpans oldStyledSpans = m_styledSpans;
             const auto oldSelStart = m_selStart;
             const auto oldSelEnd = m_selEnd;
 
@@ -883,6 +911,7 @@ namespace tgui
             if (oldText.getSize() + 1 != m_text.getSize())
             {
                 m_text = oldText;
+                m_styledSpans = oldStyledSpans;
                 m_selStart = oldSelStart;
                 m_selEnd = oldSelEnd;
 
@@ -927,7 +956,7 @@ namespace tgui
         if (m_selStart != m_selEnd)
         {
             m_selStart = m_selEnd;
-            updateSelectionTexts();
+            updateSelection();
         }
 
     #if defined (SFML_SYSTEM_ANDROID) || defined (SFML_SYSTEM_IOS)
@@ -980,11 +1009,11 @@ namespace tgui
             //    return sf::Vector2<std::size_t>(m_lines[lineNumber].getSize() - 1, lineNumber); // TextBox strips newlines but this code is kept for when this function is generalized
             //else
             if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', getTextSize(), false).advance) * 4;
+                charWidth = m_fontCached.getGlyphAdvance(' ', getTextSize(), false) * 4;
             else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, getTextSize(), false).advance);
+                charWidth = m_fontCached.getGlyphAdvance(curChar, getTextSize(), false);
 
-            const float kerning = static_cast<float>(m_fontCached.getKerning(prevChar, curChar, getTextSize()));
+            const float kerning = m_fontCached.getKerning(prevChar, curChar, getTextSize());
             if (width + charWidth + kerning <= position.x)
                 width += charWidth + kerning;
             else
@@ -1006,21 +1035,7 @@ namespace tgui
 
     std::pair<std::size_t, std::size_t> TextBox::findTextSelectionPositions() const
     {
-        // This function is used to count the amount of characters spread over several lines
-        auto findIndex = [this](std::size_t line)
-        {
-            std::size_t counter = 0;
-            for (std::size_t i = 0; i < line; ++i)
-            {
-                counter += m_lines[i].getSize();
-                if ((counter < m_text.getSize()) && (m_text[counter] == '\n'))
-                    counter += 1;
-            }
-
-            return counter;
-        };
-
-        return {findIndex(m_selStart.y) + m_selStart.x, findIndex(m_selEnd.y) + m_selEnd.x};
+        return {getLineStartInTree(m_selStart.y) + m_selStart.x, getLineStartInTree(m_selEnd.y) + m_selEnd.x};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1033,16 +1048,15 @@ namespace tgui
 
             if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
             {
-                m_text.erase(textSelectionPositions.second, textSelectionPositions.first - textSelectionPositions.second);
+                std::swap(textSelectionPositions.first, textSelectionPositions.second);
                 m_selStart = m_selEnd;
             }
             else
-            {
-                m_text.erase(textSelectionPositions.first, textSelectionPositions.second - textSelectionPositions.first);
                 m_selEnd = m_selStart;
-            }
 
-            rearrangeText(true);
+            const std::size_t removedCount = textSelectionPositions.second - textSelectionPositions.first;
+            m_text.erase(textSelectionPositions.first, removedCount);
+            rearrangeChangedText(textSelectionPositions.first, removedCount, 0);
         }
     }
 
@@ -1050,182 +1064,287 @@ namespace tgui
 
     void TextBox::rearrangeText(bool keepSelection)
     {
+        // Changes from the renderer keep the selection, they can be combined into a single update of the text
+        if (keepSelection && postponeDuringRendererUpdate())
+            return;
+
         // Don't continue when line height is 0 or when there is no font yet
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
+        {
+            m_linesOutdated = true;
             return;
-
-        // Find the maximum width of one line
-        float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
-        if (m_verticalScroll.isShown())
-            maxLineWidth -= m_verticalScroll.getSize().x;
+        }
 
         // Don't do anything when there is no room for the text
+        const float maxLineWidth = getMaxLineWidth();
         if (maxLineWidth <= 0)
+        {
+            m_linesOutdated = true;
             return;
+        }
 
         // Store the current selection position when we are keeping the selection
         std::pair<std::size_t, std::size_t> textSelectionPositions;
         if (keepSelection)
             textSelectionPositions = findTextSelectionPositions();
 
-        // Fit the text in the available space
-        const sf::String string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSize, false, false);
-
-        // Split the string in multiple lines
+        // Fit the text in the available space, one paragraph at a time
         m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != sf::String::InvalidPos)
+        m_lineEndsParagraph.clear();
+        std::size_t paragraphStart = 0;
+        while (true)
         {
-            newLinePos = string.find('\n', searchPosStart);
+            std::size_t paragraphEnd = m_text.find('\n', paragraphStart);
+            if (paragraphEnd == sf::String::InvalidPos)
+                paragraphEnd = m_text.getSize();
 
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.push_back(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.push_back(string.substring(searchPosStart));
+            const std::size_t lineCount = wrapParagraph(paragraphStart, paragraphEnd - paragraphStart, maxLineWidth, m_lines);
+            m_lineEndsParagraph.insert(m_lineEndsParagraph.end(), lineCount, false);
 
-            searchPosStart = newLinePos + 1;
+            if (paragraphEnd == m_text.getSize())
+                break;
+
+            m_lineEndsParagraph.back() = true;
+            paragraphStart = paragraphEnd + 1;
         }
 
+        rebuildLineLengthTree();
+        m_linesOutdated = false;
+
         // Check if we should try to keep our selection
         if (keepSelection)
         {
-            std::size_t index = 0;
-            sf::Vector2<std::size_t> newSelStart;
-            sf::Vector2<std::size_t> newSelEnd;
-            bool newSelStartFound = false;
-            bool newSelEndFound = false;
-
-            // Look for the new locations of our selection
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-            {
-                index += m_lines[i].getSize();
+            m_selStart = findLinePosition(textSelectionPositions.first);
+            m_selEnd = findLinePosition(textSelectionPositions.second);
+        }
+        else // Set the caret at the back of the text
+        {
+            m_selStart = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
+            m_selEnd = m_selStart;
+        }
 
-                if (!newSelStartFound && (index >= textSelectionPositions.first))
-                {
-                    newSelStart = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - textSelectionPositions.first), i);
+        // Tell the scrollbar how many pixels the text contains
+        const bool scrollbarShown = m_verticalScroll.isShown();
 
-                    newSelStartFound = true;
-                    if (newSelEndFound)
-                        break;
-                }
+        m_verticalScroll.setMaximum(static_cast<unsigned int>(m_lines.size() * m_lineHeight + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)));
 
-                if (!newSelEndFound && (index >= textSelectionPositions.second))
-                {
-                    newSelEnd = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - textSelectionPositions.second), i);
+        // We may have to recalculate what we just calculated if the scrollbar just appeared or disappeared
+        if (scrollbarShown != m_verticalScroll.isShown())
+        {
+            rearrangeText(true);
+            return;
+        }
 
-                    newSelEndFound = true;
-                    if (newSelStartFound)
-                        break;
-                }
+        updateSelection();
+    }
 
-                // Skip newlines in the text
-                if (m_text[index] == '\n')
-                    ++index;
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Keep the selection when possible
-            if (newSelStartFound && newSelEndFound)
-            {
-                m_selStart = newSelStart;
-                m_selEnd = newSelEnd;
-            }
-            else // The text has changed too much, the selection can't be kept
+    void TextBox::rearrangeChangedText(std::size_t pos, std::size_t removedCount, std::size_t insertedCount)
+    {
+        m_styledSpans.erase(pos, removedCount);
+        m_styledSpans.insert(pos, insertedCount);
+
+        // Everything has to be rearranged when the lines weren't up to date before the text was changed
+        if (m_linesOutdated || m_rendererUpdateInProgress || (m_lineHeight == 0) || (m_fontCached == nullptr))
+        {
+            rearrangeText(true);
+            return;
+        }
+
+        const float maxLineWidth = getMaxLineWidth();
+        if (maxLineWidth <= 0)
+        {
+            rearrangeText(true);
+            return;
+        }
+
+        // The lines before the changed position are still valid, so the selection can still be found
+        const std::pair<std::size_t, std::size_t> textSelectionPositions = findTextSelectionPositions();
+
+        // Find the paragraphs that contained the first and the last changed character before the text was changed.
+        // A newline ends a line in the word wrap, so changes inside a paragraph never affect the lines of other paragraphs.
+        std::size_t firstLine = findLineInTree(pos);
+        while ((firstLine > 0) && !m_lineEndsParagraph[firstLine - 1])
+            --firstLine;
+
+        std::size_t lastLine = findLineInTree(pos + removedCount);
+        while ((lastLine + 1 < m_lines.size()) && !m_lineEndsParagraph[lastLine])
+            ++lastLine;
+
+        // Wrap the changed part of the text again
+        const bool lastLineEndsParagraph = m_lineEndsParagraph[lastLine];
+        std::size_t paragraphStart = getLineStartInTree(firstLine);
+        const std::size_t changedEnd = getLineStartInTree(lastLine + 1) - (lastLineEndsParagraph ? 1 : 0) + insertedCount - removedCount;
+        std::vector<sf::String> lines;
+        std::vector<bool> lineEndsParagraph;
+        while (true)
+        {
+            std::size_t paragraphEnd = m_text.find('\n', paragraphStart);
+            if ((paragraphEnd == sf::String::InvalidPos) || (paragraphEnd > changedEnd))
+                paragraphEnd = changedEnd;
+
+            const std::size_t lineCount = wrapParagraph(paragraphStart, paragraphEnd - paragraphStart, maxLineWidth, lines);
+            lineEndsParagraph.insert(lineEndsParagraph.end(), lineCount, false);
+
+            if (paragraphEnd == changedEnd)
+                break;
+
+            lineEndsParagraph.back() = true;
+            paragraphStart = paragraphEnd + 1;
+        }
+
+        lineEndsParagraph.back() = lastLineEndsParagraph;
+
+        // Replace the old lines of the changed paragraphs
+        const std::size_t oldLineCount = lastLine - firstLine + 1;
+        if (lines.size() == oldLineCount)
+        {
+            // The amount of lines didn't change, so only the lengths of the changed lines have to be updated
+            for (std::size_t i = 0; i < lines.size(); ++i)
             {
-                m_selStart = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
-                m_selEnd = m_selStart;
+                setLineLengthInTree(firstLine + i, lines[i].getSize() + (lineEndsParagraph[i] ? 1 : 0));
+
+                m_lines[firstLine + i] = std::move(lines[i]);
+                m_lineEndsParagraph[firstLine + i] = lineEndsParagraph[i];
             }
         }
-        else // Set the caret at the back of the text
+        else
         {
-            m_selStart = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
-            m_selEnd = m_selStart;
+            m_lines.erase(m_lines.begin() + firstLine, m_lines.begin() + lastLine + 1);
+            m_lines.insert(m_lines.begin() + firstLine, std::make_move_iterator(lines.begin()), std::make_move_iterator(lines.end()));
+
+            m_lineEndsParagraph.erase(m_lineEndsParagraph.begin() + firstLine, m_lineEndsParagraph.begin() + lastLine + 1);
+            m_lineEndsParagraph.insert(m_lineEndsParagraph.begin() + firstLine, lineEndsParagraph.begin(), lineEndsParagraph.end());
+
+            rebuildLineLengthTree();
         }
 
+        m_selStart = findLinePosition(textSelectionPositions.first);
+        m_selEnd = findLinePosition(textSelectionPositions.second);
+
         // Tell the scrollbar how many pixels the text contains
         const bool scrollbarShown = m_verticalScroll.isShown();
 
         m_verticalScroll.setMaximum(static_cast<unsigned int>(m_lines.size() * m_lineHeight + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)));
 
-        // We may have to recalculate what we just calculated if the scrollbar just appeared or disappeared
+        // All lines have to be wrapped again if the scrollbar just appeared or disappeared
         if (scrollbarShown != m_verticalScroll.isShown())
         {
             rearrangeText(true);
             return;
         }
 
-        updateSelectionTexts();
+        updateSelection();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::updateSelectionTexts()
+    std::size_t TextBox::wrapParagraph(std::size_t start, std::size_t length, float maxLineWidth, std::vector<sf::String>& lines) const
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
+        const sf::String paragraph = m_text.substring(start, length);
+        const std::vector<std::size_t> lineBreaks = Text::findLineBreaks(maxLineWidth, paragraph, m_fontCached, m_textSize, false, false);
+
+        // Split the paragraph in multiple lines
+        std::size_t lineStart = 0;
+        for (const std::size_t lineBreak : lineBreaks)
         {
-            sf::String displayedText;
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-                displayedText += m_lines[i] + "\n";
-
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection1.setString("");
-            m_textSelection2.setString("");
-            m_textAfterSelection1.setString("");
-            m_textAfterSelection2.setString("");
+            lines.push_back(paragraph.substring(lineStart, lineBreak - lineStart));
+            lineStart = lineBreak;
         }
-        else // Some text is selected
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
 
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
+        lines.push_back(paragraph.substring(lineStart));
+        return lineBreaks.size() + 1;
+    }
 
-            // Set the text before the selection
-            if (selectionStart.y > 0)
-            {
-                sf::String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + "\n";
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                string += m_lines[selectionStart.y].substring(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
-            }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substring(0, selectionStart.x));
+    sf::Vector2<std::size_t> TextBox::findLinePosition(std::size_t textPosition) const
+    {
+        const std::size_t line = findLineInTree(textPosition);
+        const std::size_t lineStart = getLineStartInTree(line);
 
-            // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
-                m_textSelection2.setString("");
-            }
-            else
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, m_lines[selectionStart.y].getSize() - selectionStart.x));
+        // The position lies behind the text
+        if (textPosition > lineStart + m_lines[line].getSize())
+            return sf::Vector2<std::size_t>(m_lines[line].getSize(), line);
 
-                sf::String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + "\n";
+        // When the position is on the border of two lines then the caret is placed at the end of the first line
+        if ((textPosition == lineStart) && (line > 0) && !m_lineEndsParagraph[line - 1])
+            return sf::Vector2<std::size_t>(m_lines[line - 1].getSize(), line - 1);
 
-                string += m_lines[selectionEnd.y].substring(0, selectionEnd.x);
+        return sf::Vector2<std::size_t>(textPosition - lineStart, line);
+    }
 
-                m_textSelection2.setString(string);
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Set the text after the selection
-            {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x, m_lines[selectionEnd.y].getSize() - selectionEnd.x));
+    void TextBox::rebuildLineLengthTree()
+    {
+        // Every node in the Fenwick tree contains the sum of its own line length and the lengths in its subtree
+        m_lineLengthTree.resize(m_lines.size());
+        for (std::size_t i = 0; i < m_lines.size(); ++i)
+            m_lineLengthTree[i] = m_lines[i].getSize() + (m_lineEndsParagraph[i] ? 1 : 0);
+
+        for (std::size_t i = 1; i <= m_lineLengthTree.size(); ++i)
+        {
+            const std::size_t parent = i + (i & (~i + 1));
+            if (parent <= m_lineLengthTree.size())
+                m_lineLengthTree[parent - 1] += m_lineLengthTree[i - 1];
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::setLineLengthInTree(std::size_t line, std::size_t length)
+    {
+        const std::size_t oldLength = getLineStartInTree(line + 1) - getLineStartInTree(line);
+        for (std::size_t i = line + 1; i <= m_lineLengthTree.size(); i += (i & (~i + 1)))
+        {
+            m_lineLengthTree[i - 1] -= oldLength;
+            m_lineLengthTree[i - 1] += length;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBox::getLineStartInTree(std::size_t line) const
+    {
+        std::size_t lineStart = 0;
+        for (std::size_t i = line; i > 0; i -= (i & (~i + 1)))
+            lineStart += m_lineLengthTree[i - 1];
 
-                sf::String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + "\n";
+        return lineStart;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBox::findLineInTree(std::size_t textPosition) const
+    {
+        if (m_lineLengthTree.empty())
+            return 0;
+
+        // Walk down the tree to find how many lines start at or before the position
+        std::size_t step = 1;
+        while (step * 2 <= m_lineLengthTree.size())
+            step *= 2;
 
-                m_textAfterSelection2.setString(string);
+        std::size_t lineCount = 0;
+        for (; step > 0; step /= 2)
+        {
+            if ((lineCount + step <= m_lineLengthTree.size()) && (m_lineLengthTree[lineCount + step - 1] <= textPosition))
+            {
+                lineCount += step;
+                textPosition -= m_lineLengthTree[lineCount - 1];
             }
         }
 
+        // The position behind the last character still belongs to the last line
+        return std::min(lineCount, m_lineLengthTree.size() - 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateSelection()
+    {
         // Check if the caret is located above or below the view
         if (isVerticalScrollbarPresent())
         {
@@ -1235,11 +1354,108 @@ namespace tgui
                 m_verticalScroll.setValue(static_cast<unsigned int>(((m_selEnd.y + 1) * m_lineHeight) + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize) - m_verticalScroll.getLowValue()));
         }
 
+        // The vertices are already updated when the caret being moved into view caused other lines to become visible
+        const std::size_t firstVertexLine = m_firstVertexLine;
+        const std::size_t lastVertexLine = m_lastVertexLine;
+        recalculateVisibleLines();
+        if ((m_firstVertexLine == firstVertexLine) && (m_lastVertexLine == lastVertexLine))
+            updateVisibleLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateVisibleLines()
+    {
+        m_firstVertexLine = std::min(m_topLine, m_lines.size());
+        m_lastVertexLine = std::min(m_topLine + m_visibleLines, m_lines.size());
+
+        updateLineVertices();
         recalculatePositions();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::updateLineVertices()
+    {
+        if (!m_fontCached || (m_lastVertexLine > m_lines.size()))
+        {
+            m_lineVertices.clear();
+            return;
+        }
+
+        const auto selection = getVisibleSelection();
+        const auto& selectionStart = selection.first;
+        const auto& selectionEnd = selection.second;
+
+        m_lineVertices.resize(m_lastVertexLine - m_firstVertexLine);
+        for (std::size_t line = m_firstVertexLine; line < m_lastVertexLine; ++line)
+        {
+            std::vector<sf::Vertex>& vertices = m_lineVertices[line - m_firstVertexLine];
+            vertices.clear();
+
+            // Find out which characters on this line are selected
+            std::size_t selectedStart = 0;
+            std::size_t selectedEnd = 0;
+            if ((selectionStart != selectionEnd) && (line >= selectionStart.y) && (line <= selectionEnd.y))
+            {
+                selectedStart = (line == selectionStart.y) ? selectionStart.x : 0;
+                selectedEnd = (line == selectionEnd.y) ? selectionEnd.x : m_lines[line].getSize();
+            }
+
+            // The line is added in up to three parts, the selected part ignores the colors of the spans
+            const std::size_t lineStart = getLineStartInTree(line);
+            const sf::String& lineString = m_lines[line];
+            const float y = static_cast<float>(line * m_lineHeight);
+            float x = 0;
+            const auto addPart = [&](std::size_t partStart, std::size_t partEnd, const sf::Color& color, bool selected)
+            {
+                if (partStart >= partEnd)
+                    return;
+
+                if (partStart > 0)
+                    x += m_fontCached.getKerning(lineString[partStart - 1], lineString[partStart], m_textSize);
+
+                x = m_styledSpans.appendGlyphs(vertices, m_fontCached, m_textSize, m_text, lineStart + partStart, partEnd - partStart,
+                                               {x, y}, color, m_opacityCached, selected);
+            };
+
+            addPart(0, selectedStart, m_textColorCached, false);
+            addPart(selectedStart, selectedEnd, m_selectedTextColorCached, true);
+            addPart(std::max(selectedStart, selectedEnd), lineString.getSize(), m_textColorCached, false);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::pair<sf::Vector2<std::size_t>, sf::Vector2<std::size_t>> TextBox::getVisibleSelection() const
+    {
+        if (m_firstVertexLine >= m_lastVertexLine)
+            return {{0, m_firstVertexLine}, {0, m_firstVertexLine}};
+
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
+
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
+
+        // Parts of the selection that lie above or below the visible lines are cut off
+        const sf::Vector2<std::size_t> firstVisiblePosition{0, m_firstVertexLine};
+        const sf::Vector2<std::size_t> lastVisiblePosition{m_lines[m_lastVertexLine - 1].getSize(), m_lastVertexLine - 1};
+        auto clampPosition = [&](sf::Vector2<std::size_t> position)
+        {
+            if (position.y < m_firstVertexLine)
+                return firstVisiblePosition;
+            else if (position.y >= m_lastVertexLine)
+                return lastVisiblePosition;
+            else
+                return position;
+        };
+
+        return {clampPosition(selectionStart), clampPosition(selectionEnd)};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     sf::Vector2f TextBox::getInnerSize() const
     {
         return {getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
@@ -1248,6 +1464,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float TextBox::getMaxLineWidth() const
+    {
+        float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
+        if (m_verticalScroll.isShown())
+            maxLineWidth -= m_verticalScroll.getSize().x;
+
+        return maxLineWidth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::update(sf::Time elapsedTime)
     {
         Widget::update(elapsedTime);
@@ -1273,29 +1500,23 @@ namespace tgui
         if (!m_fontCached)
             return;
 
-        sf::Text tempText{"", *m_fontCached.getFont(), getTextSize()};
-
         // Position the caret
         {
-            tempText.setString(m_lines[m_selEnd.y].substring(0, m_selEnd.x));
-
             float kerning = 0;
             if ((m_selEnd.x > 0) && (m_selEnd.x < m_lines[m_selEnd.y].getSize()))
                 kerning = m_fontCached.getKerning(m_lines[m_selEnd.y][m_selEnd.x-1], m_lines[m_selEnd.y][m_selEnd.x], m_textSize);
 
-            m_caretPosition = {tempText.findCharacterPos(tempText.getString().getSize()).x + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
+            m_caretPosition = {Text::getLineWidth(m_lines[m_selEnd.y].substring(0, m_selEnd.x), m_fontCached, m_textSize) + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
         }
 
-        // Calculate the position of the text objects
+        // Calculate the position of the selection rectangles
         m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({0, 0});
-        if (m_selStart != m_selEnd)
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
 
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
+        const auto selection = getVisibleSelection();
+        if (selection.first != selection.second)
+        {
+            const auto& selectionStart = selection.first;
+            const auto& selectionEnd = selection.second;
 
             float kerningSelectionStart = 0;
             if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].getSize()))
@@ -1305,73 +1526,56 @@ namespace tgui
             if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].getSize()))
                 kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSize);
 
+            float selectionLeft = 0;
             if (selectionStart.x > 0)
-            {
-                m_textSelection1.setPosition({m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-            }
-            else
-                m_textSelection1.setPosition({0, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+                selectionLeft = Text::getLineWidth(m_lines[selectionStart.y].substring(0, selectionStart.x), m_fontCached, m_textSize) + kerningSelectionStart;
 
-            m_textSelection2.setPosition({0, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
+            m_selectionRects.push_back({selectionLeft, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
 
-            if (!m_textSelection2.getString().isEmpty() || (selectionEnd.x == 0))
+            if (!m_lines[selectionStart.y].isEmpty())
             {
-                m_textAfterSelection1.setPosition({m_textSelection2.findCharacterPos(m_textSelection2.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
+                // There is kerning when the selection is on just this line
+                if (selectionStart.y == selectionEnd.y)
+                {
+                    m_selectionRects.back().width = Text::getLineWidth(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x), m_fontCached, m_textSize)
+                                                    + kerningSelectionEnd;
+                }
+                else
+                    m_selectionRects.back().width = Text::getLineWidth(m_lines[selectionStart.y].substring(selectionStart.x), m_fontCached, m_textSize);
             }
-            else
-                m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection1.getPosition().y});
 
-            m_textAfterSelection2.setPosition({0, static_cast<float>((selectionEnd.y + 1) * m_lineHeight)});
+            // The selection should still be visible even when no character is selected on that line
+            if (m_selectionRects.back().width == 0)
+                m_selectionRects.back().width = 2;
 
-            // Recalculate the selection rectangles
+            for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
             {
-                m_selectionRects.push_back({m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
+                m_selectionRects.push_back({0, static_cast<float>(i * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
 
-                if (!m_lines[selectionStart.y].isEmpty())
+                if (!m_lines[i].isEmpty())
                 {
-                    m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x;
-
-                    // There is kerning when the selection is on just this line
-                    if (selectionStart.y == selectionEnd.y)
-                        m_selectionRects.back().width += kerningSelectionEnd;
+                    m_selectionRects.back().width = Text::getLineWidth(m_lines[i], m_fontCached, m_textSize);
                 }
-
-                // The selection should still be visible even when no character is selected on that line
-                if (m_selectionRects.back().width == 0)
+                else
                     m_selectionRects.back().width = 2;
+            }
 
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                {
-                    m_selectionRects.push_back({m_textSelection2.getPosition().x, static_cast<float>(i * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
-
-                    if (!m_lines[i].isEmpty())
-                    {
-                        tempText.setString(m_lines[i]);
-                        m_selectionRects.back().width = tempText.findCharacterPos(tempText.getString().getSize()).x;
-                    }
-                    else
-                        m_selectionRects.back().width = 2;
-                }
-
-                if (m_textSelection2.getString() != "")
-                {
-                    tempText.setString(m_lines[selectionEnd.y].substring(0, selectionEnd.x));
-                    m_selectionRects.push_back({m_textSelection2.getPosition().x, static_cast<float>(selectionEnd.y * m_lineHeight),
-                                                tempText.findCharacterPos(tempText.getString().getSize()).x + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
-                }
+            if ((selectionEnd.y > selectionStart.y) && ((selectionEnd.y > selectionStart.y + 1) || (selectionEnd.x > 0)))
+            {
+                m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight),
+                                            Text::getLineWidth(m_lines[selectionEnd.y].substring(0, selectionEnd.x), m_fontCached, m_textSize) + kerningSelectionEnd,
+                                            static_cast<float>(m_lineHeight)});
             }
         }
-
-        recalculateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::recalculateVisibleLines()
     {
+        if (m_lineHeight == 0)
+            return;
+
         m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) / m_lineHeight), m_lines.size());
 
         // Store which area is visible
@@ -1390,6 +1594,10 @@ namespace tgui
             m_topLine = 0;
             m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) / m_lineHeight), m_lines.size());
         }
+
+        // Only the visible lines have vertices, so they have to be updated when other lines became visible
+        if ((std::min(m_topLine, m_lines.size()) != m_firstVertexLine) || (std::min(m_topLine + m_visibleLines, m_lines.size()) != m_lastVertexLine))
+            updateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1418,14 +1626,13 @@ namespace tgui
         }
         else if (property == "textcolor")
         {
-            m_textBeforeSelection.setColor(getRenderer()->getTextColor());
-            m_textAfterSelection1.setColor(getRenderer()->getTextColor());
-            m_textAfterSelection2.setColor(getRenderer()->getTextColor());
+            m_textColorCached = getRenderer()->getTextColor();
+            updateLineVertices();
         }
         else if (property == "selectedtextcolor")
         {
-            m_textSelection1.setColor(getRenderer()->getSelectedTextColor());
-            m_textSelection2.setColor(getRenderer()->getSelectedTextColor());
+            m_selectedTextColorCached = getRenderer()->getSelectedTextColor();
+            updateLineVertices();
         }
         else if (property == "texturebackground")
         {
@@ -1461,21 +1668,11 @@ namespace tgui
 
             m_spriteBackground.setOpacity(m_opacityCached);
             m_verticalScroll.getRenderer()->setOpacity(m_opacityCached);
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection1.setOpacity(m_opacityCached);
-            m_textAfterSelection2.setOpacity(m_opacityCached);
-            m_textSelection1.setOpacity(m_opacityCached);
-            m_textSelection2.setOpacity(m_opacityCached);
+            updateLineVertices();
         }
         else if (property == "font")
         {
             Widget::rendererChanged(property);
-
-            m_textBeforeSelection.setFont(m_fontCached);
-            m_textSelection1.setFont(m_fontCached);
-            m_textSelection2.setFont(m_fontCached);
-            m_textAfterSelection1.setFont(m_fontCached);
-            m_textAfterSelection2.setFont(m_fontCached);
             setTextSize(getTextSize());
         }
         else
@@ -1484,6 +1681,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::updateAfterRendererChanges()
+    {
+        rearrangeText(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
@@ -1525,14 +1729,8 @@ namespace tgui
             }
 
             // Draw the text
-            m_textBeforeSelection.draw(target, states);
-            if (m_selStart != m_selEnd)
-            {
-                m_textSelection1.draw(target, states);
-                m_textSelection2.draw(target, states);
-                m_textAfterSelection1.draw(target, states);
-                m_textAfterSelection2.draw(target, states);
-            }
+            for (const auto& vertices : m_lineVertices)
+                Text::drawGlyphs(target, states, vertices.data(), vertices.size(), m_fontCached, m_textSize);
 
             // Only draw the caret when needed
             if (m_focused && m_caretVisible && (m_caretWidthCached > 0))
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/TGUI.hpp>
+#include <fstream>
 
 TEST_CASE("[Container]")
 {
@@ -129,6 +130,52 @@ TEST_CASE("[Container]")
             child1->remove(child4);
             REQUIRE(container->get("name") == nullptr);
         }
+
+        SECTION("name index")
+        {
+            // Widgets that were added to a panel before the panel was added to the gui are found
+            auto panel = tgui::Panel::create();
+            auto nestedPanel = tgui::Panel::create();
+            auto label = tgui::Label::create();
+            nestedPanel->add(label, "label");
+            panel->add(nestedPanel, "nested");
+            REQUIRE(panel->get("label") == label);
+
+            container->add(panel, "panel");
+            REQUIRE(container->get("label") == label);
+            REQUIRE(container->get("nested") == nestedPanel);
+            REQUIRE(widget2->get("label") == nullptr);
+            REQUIRE(nestedPanel->get("label") == label);
+            REQUIRE(nestedPanel->get("nested") == nullptr);
+
+            // Renaming a widget updates the index
+            REQUIRE(nestedPanel->setWidgetName(label, "renamed"));
+            REQUIRE(container->get("label") == nullptr);
+            REQUIRE(container->get("renamed") == label);
+
+            // Widgets added to a panel that is already in the gui are found
+            auto label2 = tgui::Label::create();
+            nestedPanel->add(label2, "label2");
+            REQUIRE(container->get("label2") == label2);
+
+            // The same name in different containers
+            widget2->add(tgui::Label::create(), "renamed");
+            REQUIRE(container->get("renamed") == widget2->get("renamed"));
+            REQUIRE(container->get("renamed") != label);
+            REQUIRE(panel->get("renamed") == label);
+
+            // Removing a container removes the widgets inside it from the index
+            container->remove(panel);
+            REQUIRE(container->get("label2") == nullptr);
+            REQUIRE(container->get("nested") == nullptr);
+            REQUIRE(panel->get("label2") == label2);
+
+            container->add(panel);
+            REQUIRE(container->get("label2") == label2);
+            panel->removeAllWidgets();
+            REQUIRE(container->get("label2") == nullptr);
+            REQUIRE(container->get("nested") == nullptr);
+        }
     }
 
     SECTION("remove")
@@ -209,6 +256,178 @@ TEST_CASE("[Container]")
         REQUIRE(container->getWidgetName(widget3) == "w003");
     }
 
+    SECTION("lazy loading")
+    {
+        const std::string widgetFile = "Panel.HiddenPanel {\n"
+                                       "    Visible = false;\n"
+                                       "    Label.InnerLabel { Text = \"Hello\"; }\n"
+                                       "    Panel.NestedPanel {\n"
+                                       "        Visible = false;\n"
+                                       "        Button.InnerButton { Text = \"Click\"; }\n"
+                                       "    }\n"
+                                       "}\n"
+                                       "Panel.VisiblePanel {\n"
+                                       "    Label.OtherLabel { Text = \"World\"; }\n"
+                                       "}\n";
+
+        container->removeAllWidgets();
+
+        REQUIRE(!tgui::WidgetLoader::getLazyLoading());
+        tgui::WidgetLoader::setLazyLoading(true);
+        REQUIRE(tgui::WidgetLoader::getLazyLoading());
+        container->loadWidgetsFromStream(std::stringstream{widgetFile});
+        tgui::WidgetLoader::setLazyLoading(false);
+
+        auto hiddenPanel = container->get<tgui::Panel>("HiddenPanel");
+        auto visiblePanel = container->get<tgui::Panel>("VisiblePanel");
+        REQUIRE(hiddenPanel->hasLazyChildren());
+        REQUIRE(!visiblePanel->hasLazyChildren());
+        REQUIRE(container->get<tgui::Label>("OtherLabel")->getText() == "World");
+
+        SECTION("Unknown name")
+        {
+            REQUIRE(container->get("Unknown") == nullptr);
+            REQUIRE(hiddenPanel->hasLazyChildren());
+        }
+
+        SECTION("Show")
+        {
+            hiddenPanel->show();
+            REQUIRE(!hiddenPanel->hasLazyChildren());
+            REQUIRE(hiddenPanel->get<tgui::Panel>("NestedPanel")->hasLazyChildren());
+            REQUIRE(container->get<tgui::Label>("InnerLabel")->getText() == "Hello");
+        }
+
+        SECTION("Get")
+        {
+            REQUIRE(container->get<tgui::Button>("InnerButton")->getText() == "Click");
+            REQUIRE(!hiddenPanel->hasLazyChildren());
+            REQUIRE(!hiddenPanel->get<tgui::Panel>("NestedPanel")->hasLazyChildren());
+            REQUIRE(hiddenPanel->getWidgetNames().size() == 2);
+        }
+
+        SECTION("Get from container outside gui")
+        {
+            container->remove(hiddenPanel);
+            REQUIRE(hiddenPanel->get<tgui::Label>("InnerLabel")->getText() == "Hello");
+            REQUIRE(!hiddenPanel->hasLazyChildren());
+        }
+
+        SECTION("Copy")
+        {
+            auto copiedPanel = tgui::Panel::copy(hiddenPanel);
+            REQUIRE(hiddenPanel->hasLazyChildren());
+            REQUIRE(copiedPanel->hasLazyChildren());
+            REQUIRE(copiedPanel->getWidgets().size() == 2);
+            REQUIRE(copiedPanel->get<tgui::Label>("InnerLabel") != container->get<tgui::Label>("InnerLabel"));
+
+            // Both containers load the nested widgets themselves
+            REQUIRE(copiedPanel->get<tgui::Button>("InnerButton")->getText() == "Click");
+            REQUIRE(container->get<tgui::Button>("InnerButton")->getText() == "Click");
+            REQUIRE(copiedPanel->get<tgui::Button>("InnerButton") != container->get<tgui::Button>("InnerButton"));
+        }
+
+        SECTION("Const access")
+        {
+            // The const functions load the delayed widgets as well
+            const tgui::Panel& constPanel = *hiddenPanel;
+            REQUIRE(constPanel.get("InnerLabel") != nullptr);
+            REQUIRE(!hiddenPanel->hasLazyChildren());
+            REQUIRE(constPanel.getWidgetNames().size() == 2);
+            REQUIRE(constPanel.get("InnerLabel") == hiddenPanel->get("InnerLabel"));
+
+            const tgui::Panel& constNestedPanel = *hiddenPanel->get<tgui::Panel>("NestedPanel");
+            REQUIRE(constNestedPanel.hasLazyChildren());
+            REQUIRE(constNestedPanel.getWidgets().size() == 1);
+        }
+
+        SECTION("Save const container")
+        {
+            // The delayed widgets, including the ones of the nested container, are loaded before they are saved
+            tgui::Container::ConstPtr constPanel = hiddenPanel;
+            std::stringstream stream;
+            tgui::WidgetSaver::save(constPanel, stream);
+            REQUIRE(stream.str().find("InnerLabel") != std::string::npos);
+            REQUIRE(stream.str().find("InnerButton") != std::string::npos);
+
+            std::stringstream stream2;
+            constPanel->saveWidgetsToStream(stream2);
+            REQUIRE(stream2.str() == stream.str());
+        }
+
+        SECTION("Error while loading")
+        {
+            container->removeAllWidgets();
+            tgui::WidgetLoader::setLazyLoading(true);
+            container->loadWidgetsFromStream(std::stringstream{"Panel.BrokenPanel {\n"
+                                                               "    Visible = false;\n"
+                                                               "    UnknownWidget.Unknown {}\n"
+                                                               "}\n"});
+            tgui::WidgetLoader::setLazyLoading(false);
+            REQUIRE_THROWS_AS(container->get<tgui::Panel>("BrokenPanel")->show(), tgui::Exception);
+
+            // Hidden containers are no longer delayed after the failed load
+            container->loadWidgetsFromStream(std::stringstream{widgetFile});
+            REQUIRE(!container->get<tgui::Panel>("HiddenPanel")->hasLazyChildren());
+            REQUIRE(!tgui::WidgetLoader::getLazyLoading());
+        }
+
+        SECTION("Remove all widgets")
+        {
+            hiddenPanel->removeAllWidgets();
+            REQUIRE(!hiddenPanel->hasLazyChildren());
+            REQUIRE(container->get("InnerLabel") == nullptr);
+            REQUIRE(hiddenPanel->getWidgets().empty());
+        }
+
+        SECTION("Saving")
+        {
+            std::stringstream lazyStream;
+            container->saveWidgetsToStream(lazyStream);
+
+            container->removeAllWidgets();
+            container->loadWidgetsFromStream(std::stringstream{widgetFile});
+            std::stringstream eagerStream;
+            container->saveWidgetsToStream(eagerStream);
+
+            REQUIRE(lazyStream.str() == eagerStream.str());
+        }
+    }
+
+    SECTION("saving to file")
+    {
+        auto panel = tgui::Panel::create();
+        panel->add(tgui::Label::create("Hello"), "Label");
+        panel->add(tgui::Button::create("Click"), "Button");
+
+        REQUIRE_NOTHROW(panel->saveWidgetsToFile("ContainerWidgetFile.txt"));
+        const auto readFile = []
+        {
+            std::ifstream in{"ContainerWidgetFile.txt"};
+            return std::string{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+        };
+        const std::string originalContents = readFile();
+        REQUIRE(originalContents.find("Click") != std::string::npos);
+
+        // When saving fails after part of the widgets were written, the existing file is kept intact
+        const auto oldSaveFunction = tgui::WidgetSaver::getSaveFunction("button");
+        tgui::WidgetSaver::setSaveFunction("button", [](tgui::Widget::Ptr) -> std::unique_ptr<tgui::DataIO::Node>
+        {
+            throw tgui::Exception{"Button can't be saved"};
+        });
+
+        panel->get<tgui::Button>("Button")->setText("Changed");
+        REQUIRE_THROWS_AS(panel->saveWidgetsToFile("ContainerWidgetFile.txt"), tgui::Exception);
+        tgui::WidgetSaver::setSaveFunction("button", oldSaveFunction);
+
+        REQUIRE(readFile() == originalContents);
+        REQUIRE(!std::ifstream{"ContainerWidgetFile.txt.tmp"}.is_open());
+
+        // A successful save replaces the file
+        REQUIRE_NOTHROW(panel->saveWidgetsToFile("ContainerWidgetFile.txt"));
+        REQUIRE(readFile().find("Changed") != std::string::npos);
+    }
+
     SECTION("focus")
     {
         auto editBox1 = tgui::EditBox::create();
@@ -0,0 +1,181 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/DistanceFieldAtlas.hpp>
+#include <TGUI/GlyphRunCache.hpp>
+#include <TGUI/Text.hpp>
+
+TEST_CASE("[DistanceFieldAtlas]")
+{
+    tgui::Font font{"resources/DejaVuSans.ttf"};
+
+    SECTION("Glyphs")
+    {
+        tgui::DistanceFieldAtlas atlas{font.getFont(), 32, 4};
+        REQUIRE(atlas.getBaseCharacterSize() == 32);
+        REQUIRE(atlas.getSpread() == 4);
+        REQUIRE(atlas.getScale(64) == 2);
+        REQUIRE(atlas.getGlyphCount() == 0);
+
+        const sf::Glyph& fontGlyph = font.getGlyph('A', 32, false);
+        const sf::FloatRect fontBounds = fontGlyph.bounds;
+        const sf::IntRect fontTextureRect = fontGlyph.textureRect;
+        const float fontAdvance = fontGlyph.advance;
+
+        const tgui::DistanceFieldAtlas::Glyph& glyph = atlas.getGlyph('A', false);
+        REQUIRE(glyph.advance == fontAdvance);
+        REQUIRE(glyph.bounds == sf::FloatRect(fontBounds.left - 4, fontBounds.top - 4, fontTextureRect.width + 8.f, fontTextureRect.height + 8.f));
+        REQUIRE(glyph.textureRect.width == glyph.bounds.width);
+        REQUIRE(glyph.textureRect.height == glyph.bounds.height);
+        REQUIRE(atlas.getGlyphCount() == 1);
+
+        // Glyphs are only added once
+        REQUIRE(&atlas.getGlyph('A', false) == &glyph);
+        REQUIRE(atlas.getGlyphCount() == 1);
+
+        // The bold version is a different glyph
+        REQUIRE(atlas.getGlyph('A', true).textureRect != glyph.textureRect);
+        REQUIRE(atlas.getGlyphCount() == 2);
+
+        // Glyphs without pixels don't take space in the texture
+        REQUIRE(atlas.getGlyph(' ', false).advance == font.getGlyph(' ', 32, false).advance);
+        REQUIRE(atlas.getGlyph(' ', false).textureRect.width == 0);
+
+        atlas.loadGlyphs("xHelloA", 1, 5, false);
+        REQUIRE(atlas.getGlyphCount() == 7);
+        REQUIRE(atlas.getGlyph('H', false).textureRect != atlas.getGlyph('e', false).textureRect);
+
+        // Glyphs don't overlap with each other or with the opaque block
+        const sf::Vector2f solidTexCoords = atlas.getSolidTexCoords();
+        for (const sf::Uint32 c : sf::String("AHelo"))
+        {
+            REQUIRE(!atlas.getGlyph(c, false).textureRect.contains(solidTexCoords));
+            for (const sf::Uint32 other : sf::String("AHelo"))
+            {
+                if (c != other)
+                    REQUIRE(!atlas.getGlyph(c, false).textureRect.intersects(atlas.getGlyph(other, false).textureRect));
+            }
+        }
+    }
+
+    SECTION("Texture size is limited")
+    {
+        tgui::DistanceFieldAtlas atlas{font.getFont(), 32, 4, 128};
+        REQUIRE(atlas.getTextureSize().x == 128);
+        REQUIRE(atlas.getTextureSize().y <= 128);
+
+        for (sf::Uint32 c = 'A'; c <= 'Z'; ++c)
+            atlas.getGlyph(c, false);
+
+        REQUIRE(atlas.getTextureSize() == sf::Vector2u(128, 128));
+        REQUIRE(atlas.getTexture().getSize() == sf::Vector2u(128, 128));
+
+        // Glyphs that no longer fit are empty, but still have the correct advance
+        REQUIRE(atlas.getGlyph('A', false).textureRect.width > 0);
+        REQUIRE(atlas.getGlyph('Z', false).textureRect.width == 0);
+        REQUIRE(atlas.getGlyph('Z', false).advance == font.getGlyph('Z', 32, false).advance);
+        REQUIRE(atlas.getGlyphCount() == 26);
+    }
+
+    SECTION("Texture grows")
+    {
+        tgui::DistanceFieldAtlas atlas{font.getFont(), 32, 4, 1024};
+        REQUIRE(atlas.getTextureSize() == sf::Vector2u(512, 64));
+
+        // The texture first becomes higher and only becomes wider once it reached the maximum height
+        sf::Uint32 lastChar = 0x21;
+        while ((atlas.getTextureSize().x == 512) && (lastChar < 0x2000))
+            atlas.getGlyph(lastChar++, false);
+
+        REQUIRE(atlas.getTextureSize() == sf::Vector2u(1024, 1024));
+        REQUIRE(atlas.getTexture().getSize() == sf::Vector2u(1024, 1024));
+
+        // All glyphs still fit in the texture
+        for (sf::Uint32 c = 0x21; c < lastChar; ++c)
+        {
+            const sf::IntRect& fontTextureRect = font.getGlyph(c, 32, false).textureRect;
+            if (fontTextureRect.width > 0)
+                REQUIRE(atlas.getGlyph(c, false).textureRect.width == fontTextureRect.width + 8);
+        }
+    }
+
+    SECTION("Font")
+    {
+        REQUIRE(!font.isDistanceFieldRendering());
+        REQUIRE(font.getDistanceFieldAtlas() == nullptr);
+
+        const float advance = font.getGlyphAdvance('A', 40, false);
+        const auto fontRun = tgui::GlyphRunCache::getGlyphRun(font, 40, sf::Text::Underlined, "A");
+
+        tgui::Font fontCopy = font;
+        font.setDistanceFieldRendering(true);
+        REQUIRE(font.isDistanceFieldRendering());
+        REQUIRE(fontCopy.isDistanceFieldRendering());
+        REQUIRE(font.getDistanceFieldAtlas() != nullptr);
+        REQUIRE(font.getDistanceFieldAtlas() == fontCopy.getDistanceFieldAtlas());
+
+        const auto atlas = font.getDistanceFieldAtlas();
+        const tgui::DistanceFieldAtlas::Glyph& glyph = atlas->getGlyph('A', false);
+        REQUIRE(font.getGlyphAdvance('A', 40, false) == Approx(glyph.advance * 40 / atlas->getBaseCharacterSize()));
+        REQUIRE(font.getGlyphAdvance('A', 40, false) == Approx(advance));
+
+        // Glyphs are scaled from the base size and use the texture coordinates of the atlas
+        const auto run = tgui::GlyphRunCache::getGlyphRun(font, 40, sf::Text::Underlined, "A");
+        REQUIRE(run != fontRun);
+        REQUIRE(run->size() == 2 * 6);
+
+        const float scale = atlas->getScale(40);
+        REQUIRE((*run)[0].position.x == Approx(glyph.bounds.left * scale));
+        REQUIRE((*run)[0].position.y == Approx(40 + glyph.bounds.top * scale));
+        REQUIRE((*run)[5].position.x == Approx((glyph.bounds.left + glyph.bounds.width) * scale));
+        REQUIRE((*run)[5].position.y == Approx(40 + (glyph.bounds.top + glyph.bounds.height) * scale));
+        REQUIRE((*run)[0].texCoords == sf::Vector2f(glyph.textureRect.left, glyph.textureRect.top));
+        REQUIRE((*run)[5].texCoords == sf::Vector2f(glyph.textureRect.left + glyph.textureRect.width, glyph.textureRect.top + glyph.textureRect.height));
+        REQUIRE((*run)[6].texCoords == atlas->getSolidTexCoords());
+
+        // Other character sizes don't add glyphs to the atlas
+        const std::size_t glyphCount = atlas->getGlyphCount();
+        tgui::GlyphRunCache::getGlyphRun(font, 13, sf::Text::Regular, "A");
+        tgui::GlyphRunCache::getGlyphRun(font, 71, sf::Text::Regular, "A");
+        REQUIRE(atlas->getGlyphCount() == glyphCount);
+
+        tgui::Text text;
+        text.setFont(font);
+        text.setString("Text");
+        text.setCharacterSize(27);
+        text.setColor(sf::Color::Red);
+        REQUIRE(text.getSize().x == Approx(tgui::Text::getLineWidth("Text", font, 27)));
+
+        sf::RenderTexture target;
+        target.create(100, 100);
+        text.draw(target, {});
+
+        font.setDistanceFieldRendering(false);
+        REQUIRE(!fontCopy.isDistanceFieldRendering());
+        REQUIRE(font.getDistanceFieldAtlas() == nullptr);
+        REQUIRE(font.getGlyphAdvance('A', 40, false) == advance);
+    }
+}
@@ -35,4 +35,42 @@ TEST_CASE("[Font]")
     REQUIRE(tgui::Font(font1).getFont() != nullptr);
     REQUIRE(tgui::Font(font2).getFont() == font2);
     REQUIRE(tgui::Font("resources/DejaVuSans.ttf").getFont() != nullptr);
+
+    SECTION("Cached metrics")
+    {
+        tgui::Font font{"resources/DejaVuSans.ttf"};
+        const tgui::Font copy = font;
+
+        for (const sf::Uint32 codePoint : {sf::Uint32('a'), sf::Uint32(' '), sf::Uint32(0xE9), sf::Uint32(0x20AC)})
+        {
+            REQUIRE(font.getGlyphAdvance(codePoint, 20, false) == font.getGlyph(codePoint, 20, false).advance);
+            REQUIRE(font.getGlyphAdvance(codePoint, 20, true) == font.getGlyph(codePoint, 20, true).advance);
+            REQUIRE(font.getGlyphAdvance(codePoint, 30, false) == font.getGlyph(codePoint, 30, false).advance);
+            REQUIRE(copy.getGlyphAdvance(codePoint, 20, false) == font.getGlyphAdvance(codePoint, 20, false));
+        }
+
+        REQUIRE(font.getKerning('A', 'V', 20) == font.getFont()->getKerning('A', 'V', 20));
+        REQUIRE(font.getKerning('A', 'V', 20) == copy.getKerning('A', 'V', 20));
+        REQUIRE(font.getKerning('A', 'V', 30) == font.getFont()->getKerning('A', 'V', 30));
+        REQUIRE(font.getKerning(0, 'V', 20) == 0);
+        REQUIRE(tgui::Font().getKerning('A', 'V', 20) == 0);
+        REQUIRE(font.getKerning(0xE9, 0x20AC, 20) == font.getFont()->getKerning(0xE9, 0x20AC, 20));
+    }
+
+    SECTION("Metrics are shared between fonts with the same sf::Font")
+    {
+        tgui::Font font{std::make_shared<sf::Font>()};
+        font.setDistanceFieldRendering(true);
+
+        // Fonts that are created again from the sf::Font keep the cached metrics and the distance field atlas
+        const tgui::Font sameFont{font.getFont()};
+        REQUIRE(sameFont.isDistanceFieldRendering());
+        REQUIRE(sameFont.getDistanceFieldAtlas() == font.getDistanceFieldAtlas());
+
+        const tgui::Font otherFont{std::make_shared<sf::Font>()};
+        REQUIRE(!otherFont.isDistanceFieldRendering());
+
+        font.setDistanceFieldRendering(false);
+        REQUIRE(!sameFont.isDistanceFieldRendering());
+    }
 }
@@ -0,0 +1,160 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/GlyphRunCache.hpp>
+#include <TGUI/Text.hpp>
+
+TEST_CASE("[GlyphRunCache]")
+{
+    tgui::GlyphRunCache::clear();
+    const std::size_t oldMemoryLimit = tgui::GlyphRunCache::getMemoryLimit();
+
+    tgui::Font font{"resources/DejaVuSans.ttf"};
+
+    SECTION("Identical strings share a run")
+    {
+        auto run1 = tgui::GlyphRunCache::getGlyphRun(font, 20, sf::Text::Regular, "Item");
+        auto run2 = tgui::GlyphRunCache::getGlyphRun(font, 20, sf::Text::Regular, "Item");
+        REQUIRE(run1 == run2);
+        REQUIRE(run1->size() == 4 * 6);
+
+        REQUIRE(tgui::GlyphRunCache::getGlyphRun(font, 20, sf::Text::Regular, "Other") != run1);
+        REQUIRE(tgui::GlyphRunCache::getGlyphRun(font, 21, sf::Text::Regular, "Item") != run1);
+        REQUIRE(tgui::GlyphRunCache::getGlyphRun(font, 20, sf::Text::Bold, "Item") != run1);
+        REQUIRE(tgui::GlyphRunCache::getGlyphRun(tgui::Font{std::make_shared<sf::Font>()}, 20, sf::Text::Regular, "Item") != run1);
+        REQUIRE(tgui::GlyphRunCache::getGlyphRun(font, 20, sf::Text::Regular, "Item", sf::Color::Red) != run1);
+
+        // Spaces don't have vertices, underlined text gets an extra quad
+        REQUIRE(tgui::GlyphRunCache::getGlyphRun(font, 20, sf::Text::Regular, "I tem")->size() == 4 * 6);
+        REQUIRE(tgui::GlyphRunCache::getGlyphRun(font, 20, sf::Text::Underlined, "Item")->size() == 5 * 6);
+
+        const auto statistics = tgui::GlyphRunCache::getStatistics();
+        REQUIRE(statistics.runCount == 8);
+        REQUIRE(statistics.hits == 1);
+        REQUIRE(statistics.misses == 8);
+        REQUIRE(statistics.evictions == 0);
+        REQUIRE(statistics.memoryUsage > 0);
+    }
+
+    SECTION("Vertices are relative to the origin")
+    {
+        tgui::GlyphRunCache::GlyphRun vertices;
+        tgui::GlyphRunCache::appendGlyphs(vertices, font, 20, sf::Text::Regular, "AB", 0, 2, {0, 0}, sf::Color::White);
+
+        tgui::GlyphRunCache::GlyphRun shiftedVertices;
+        tgui::GlyphRunCache::appendGlyphs(shiftedVertices, font, 20, sf::Text::Regular, "xAB", 1, 2, {10, 5}, sf::Color::Red);
+
+        const auto run = tgui::GlyphRunCache::getGlyphRun(font, 20, sf::Text::Regular, "AB");
+        REQUIRE(run->size() == vertices.size());
+        REQUIRE(shiftedVertices.size() == vertices.size());
+        for (std::size_t i = 0; i < vertices.size(); ++i)
+        {
+            REQUIRE((*run)[i].position == vertices[i].position);
+            REQUIRE((*run)[i].texCoords == vertices[i].texCoords);
+            REQUIRE(shiftedVertices[i].position == vertices[i].position + sf::Vector2f(10, 5));
+            REQUIRE(shiftedVertices[i].texCoords == vertices[i].texCoords);
+            REQUIRE(shiftedVertices[i].color == sf::Color::Red);
+        }
+    }
+
+    SECTION("Least recently used runs are evicted")
+    {
+        auto run1 = tgui::GlyphRunCache::getGlyphRun(font, 20, sf::Text::Regular, "First");
+        const std::size_t memoryPerRun = tgui::GlyphRunCache::getStatistics().memoryUsage;
+
+        tgui::GlyphRunCache::setMemoryLimit(2 * memoryPerRun);
+        REQUIRE(tgui::GlyphRunCache::getMemoryLimit() == 2 * memoryPerRun);
+
+        tgui::GlyphRunCache::getGlyphRun(font, 20, sf::Text::Regular, "Secnd");
+        REQUIRE(tgui::GlyphRunCache::getGlyphRun(font, 20, sf::Text::Regular, "First") == run1);
+
+        tgui::GlyphRunCache::getGlyphRun(font, 20, sf::Text::Regular, "Third");
+        auto statistics = tgui::GlyphRunCache::getStatistics();
+        REQUIRE(statistics.runCount == 2);
+        REQUIRE(statistics.evictions == 1);
+        REQUIRE(statistics.memoryUsage <= 2 * memoryPerRun);
+
+        // The second string was used least recently, so it was removed while the first one is still cached
+        REQUIRE(tgui::GlyphRunCache::getGlyphRun(font, 20, sf::Text::Regular, "First") == run1);
+        REQUIRE(tgui::GlyphRunCache::getStatistics().misses == 3);
+
+        tgui::GlyphRunCache::getGlyphRun(font, 20, sf::Text::Regular, "Secnd");
+        REQUIRE(tgui::GlyphRunCache::getStatistics().misses == 4);
+
+        // Runs that are removed from the cache remain valid
+        tgui::GlyphRunCache::clear();
+        REQUIRE(tgui::GlyphRunCache::getStatistics().runCount == 0);
+        REQUIRE(tgui::GlyphRunCache::getStatistics().memoryUsage == 0);
+        REQUIRE(run1->size() == 5 * 6);
+    }
+
+    SECTION("Texts use the cache")
+    {
+        tgui::Text text1;
+        text1.setFont(font);
+        text1.setCharacterSize(15);
+        text1.setString("Caption");
+        text1.setColor(sf::Color::Green);
+
+        tgui::Text text2 = text1;
+        text2.setPosition(100, 50);
+
+        sf::RenderTexture target;
+        target.create(200, 100);
+        text1.draw(target, {});
+        text2.draw(target, {});
+
+        auto statistics = tgui::GlyphRunCache::getStatistics();
+        REQUIRE(statistics.runCount == 1);
+        REQUIRE(statistics.hits == 1);
+        REQUIRE(statistics.misses == 1);
+
+        // The color is part of the run, so a text with another color or opacity gets its own run
+        text2.setColor(sf::Color::Blue);
+        text2.draw(target, {});
+        text2.setColor(sf::Color::Green);
+        text2.setOpacity(0.5f);
+        text2.draw(target, {});
+        statistics = tgui::GlyphRunCache::getStatistics();
+        REQUIRE(statistics.runCount == 3);
+        REQUIRE(statistics.misses == 3);
+
+        // Changing the color back shares the run again
+        text2.setOpacity(1);
+        text2.draw(target, {});
+        statistics = tgui::GlyphRunCache::getStatistics();
+        REQUIRE(statistics.runCount == 3);
+        REQUIRE(statistics.hits == 2);
+
+        const auto run = tgui::GlyphRunCache::getGlyphRun(font, 15, sf::Text::Regular, "Caption", sf::Color::Green);
+        REQUIRE(!run->empty());
+        for (const auto& vertex : *run)
+            REQUIRE(vertex.color == sf::Color::Green);
+    }
+
+    tgui::GlyphRunCache::setMemoryLimit(oldMemoryLimit);
+    tgui::GlyphRunCache::clear();
+}
@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/EditBox.hpp>
+
+TEST_CASE("[InputValidator]")
+{
+    SECTION("Presets")
+    {
+        tgui::InputValidator validator{tgui::EditBox::Validator::Float};
+        REQUIRE(validator.getPattern() == tgui::EditBox::Validator::Float);
+        REQUIRE(validator.isCompiled());
+
+        for (const auto& text : {"", "-5", "+642", "1.5", "-6.", ".001", "."})
+            REQUIRE(validator.match(text));
+
+        for (const auto& text : {"text", "1.5.", "--1", "1-", "1e5"})
+            REQUIRE(!validator.match(text));
+
+        REQUIRE(tgui::InputValidator{tgui::EditBox::Validator::Int}.match("-15"));
+        REQUIRE(!tgui::InputValidator{tgui::EditBox::Validator::Int}.match("1.5"));
+        REQUIRE(tgui::InputValidator{tgui::EditBox::Validator::UInt}.match("15"));
+        REQUIRE(!tgui::InputValidator{tgui::EditBox::Validator::UInt}.match("-15"));
+    }
+
+    SECTION("Syntax")
+    {
+        REQUIRE(tgui::InputValidator{"a|bc|"}.match("bc"));
+        REQUIRE(tgui::InputValidator{"a|bc|"}.match(""));
+        REQUIRE(!tgui::InputValidator{"a|bc|"}.match("ab"));
+
+        REQUIRE(tgui::InputValidator{"(?:ab)+c?"}.match("ababc"));
+        REQUIRE(!tgui::InputValidator{"(ab)+c?"}.match("c"));
+
+        REQUIRE(tgui::InputValidator{"x{2,3}"}.match("xxx"));
+        REQUIRE(!tgui::InputValidator{"x{2,3}"}.match("x"));
+        REQUIRE(!tgui::InputValidator{"x{2,3}"}.match("xxxx"));
+        REQUIRE(tgui::InputValidator{"(xy){2,}"}.match("xyxyxy"));
+        REQUIRE(tgui::InputValidator{"a{2}b*?"}.match("aabb"));
+
+        REQUIRE(tgui::InputValidator{"^[^0-9\\s]\\w*\\.$"}.match("_abc9."));
+        REQUIRE(!tgui::InputValidator{"^[^0-9\\s]\\w*\\.$"}.match("9abc."));
+        REQUIRE(!tgui::InputValidator{"^[^0-9\\s]\\w*\\.$"}.match("abc"));
+
+        REQUIRE(tgui::InputValidator{"[a\\-z]+"}.match("-az"));
+        REQUIRE(!tgui::InputValidator{"[a\\-z]+"}.match("b"));
+        REQUIRE(tgui::InputValidator{"\\x41\\u0042[\\d.]"}.match("AB."));
+        REQUIRE(!tgui::InputValidator{"."}.match("\n"));
+    }
+
+    SECTION("Unicode")
+    {
+        tgui::InputValidator validator{"[a-z\\u00C0-\\u00FF]+"};
+        REQUIRE(validator.match(L"café"));
+        REQUIRE(!validator.match(L"cafĀ"));
+
+        REQUIRE(tgui::InputValidator{".\\W"}.match(L"中文"));
+    }
+
+    SECTION("States")
+    {
+        tgui::InputValidator validator{"[0-9]{1,3}(\\.[0-9]{1,3}){3}"};
+
+        const sf::String text = "192.168.0.1";
+        auto state = validator.getStartState();
+        for (std::size_t i = 0; i < text.getSize(); ++i)
+        {
+            state = validator.getNextState(state, text[i]);
+            REQUIRE(validator.isAccepting(state) == (i + 1 == text.getSize()));
+        }
+
+        REQUIRE(validator.isAccepting(state));
+        REQUIRE(validator.isAccepting(validator.getNextState(state, '0')));
+        REQUIRE(!validator.isAccepting(validator.getNextState(state, '.')));
+        REQUIRE(validator.getNextState(validator.getStartState(), "192.168.0.1", 3) != state);
+        REQUIRE(validator.getNextState(validator.getNextState(validator.getStartState(), "192"), "192.168.0.1", 3) == state);
+    }
+
+    SECTION("Unsupported patterns fall back to std::regex")
+    {
+        tgui::InputValidator validator{"(a+)b\\1"};
+        REQUIRE(!validator.isCompiled());
+        REQUIRE(validator.match("aabaa"));
+        REQUIRE(!validator.match("aaba"));
+
+        REQUIRE_THROWS_AS(tgui::InputValidator{"(a"}, std::regex_error);
+    }
+}
@@ -0,0 +1,185 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "../Tests.hpp"
+#include <TGUI/Loading/BinaryThemeLoader.hpp>
+#include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <fstream>
+#include <future>
+
+namespace
+{
+    void compareRenderers(const std::map<std::string, tgui::ObjectConverter>& expected, const std::map<std::string, tgui::ObjectConverter>& actual)
+    {
+        REQUIRE(expected.size() == actual.size());
+        for (const auto& pair : expected)
+        {
+            REQUIRE(actual.find(pair.first) != actual.end());
+            REQUIRE(actual.at(pair.first).getType() == pair.second.getType());
+            if (pair.second.getType() == tgui::ObjectConverter::Type::RendererData)
+                compareRenderers(tgui::ObjectConverter{pair.second}.getRenderer()->propertyValuePairs, tgui::ObjectConverter{actual.at(pair.first)}.getRenderer()->propertyValuePairs);
+            else
+                REQUIRE(tgui::ObjectConverter{actual.at(pair.first)}.getString() == tgui::ObjectConverter{pair.second}.getString());
+        }
+    }
+}
+
+TEST_CASE("[BinaryThemeLoader]")
+{
+    tgui::DefaultThemeLoader::flushCache();
+
+    auto defaultLoader = std::make_shared<tgui::DefaultThemeLoader>();
+    auto loader = std::make_shared<tgui::BinaryThemeLoader>();
+
+    SECTION("compile black theme")
+    {
+        tgui::BinaryThemeLoader::compile("resources/Black.txt", "resources/BlackCompiled.tgt");
+
+        for (const auto& section : defaultLoader->getSectionNames("resources/Black.txt"))
+            compareRenderers(defaultLoader->loadRenderer("resources/Black.txt", section)->propertyValuePairs, loader->loadRenderer("resources/BlackCompiled.tgt", section)->propertyValuePairs);
+
+        // The texture filenames are relative to the binary file
+        REQUIRE(tgui::ObjectConverter{loader->loadRenderer("resources/BlackCompiled.tgt", "Button")->propertyValuePairs["texture"]}.getString().find("resources/Black.png") != sf::String::InvalidPos);
+
+        // Section names are case-insensitive
+        REQUIRE(loader->loadRenderer("resources/BlackCompiled.tgt", "BUTTON") == loader->loadRenderer("resources/BlackCompiled.tgt", "button"));
+    }
+
+    SECTION("compile nested sections")
+    {
+        tgui::BinaryThemeLoader::compile("resources/ThemeNested.txt", "resources/ThemeNestedCompiled.tgt");
+
+        for (const auto& section : defaultLoader->getSectionNames("resources/ThemeNested.txt"))
+            compareRenderers(defaultLoader->loadRenderer("resources/ThemeNested.txt", section)->propertyValuePairs, loader->loadRenderer("resources/ThemeNestedCompiled.tgt", section)->propertyValuePairs);
+
+        // Every call returns the same copy-on-write data, which is also shared by the sections that reference it
+        auto renderer1 = loader->loadRenderer("resources/ThemeNestedCompiled.tgt", "ComboBox1");
+        auto renderer2 = loader->loadRenderer("resources/ThemeNestedCompiled.tgt", "ComboBox1");
+        REQUIRE(renderer1 == renderer2);
+        REQUIRE(renderer1->copyOnWrite);
+        REQUIRE(renderer1->propertyValuePairs["listbox"].getRenderer()->copyOnWrite);
+
+        // The string interface returns the nested sections in text form
+        const auto& properties = loader->load("resources/ThemeNestedCompiled.tgt", "ListBox1");
+        REQUIRE(properties.size() == 2);
+        REQUIRE(properties.at("backgroundcolor") == "White");
+        REQUIRE(tgui::ObjectConverter{properties.at("scrollbar")}.getRenderer()->propertyValuePairs.size() == 2);
+        REQUIRE(tgui::ObjectConverter{properties.at("scrollbar")}.getRenderer()->propertyValuePairs["thumbcolor"].getColor() == sf::Color::Green);
+    }
+
+    SECTION("non-ASCII values")
+    {
+        {
+            std::ofstream file{"resources/ThemeNonAscii.txt", std::ios::binary};
+            file << "Label {\n"
+                    "    Caption = \"Caf\xC3\xA9 \xE2\x82\xAC\";\n"
+                    "    Texture = \"Textur\xC3\xA9.png\";\n"
+                    "}\n";
+        }
+
+        tgui::BinaryThemeLoader::compile("resources/ThemeNonAscii.txt", "resources/ThemeNonAsciiCompiled.tgt");
+
+        const auto expected = defaultLoader->loadRenderer("resources/ThemeNonAscii.txt", "Label");
+        const auto actual = loader->loadRenderer("resources/ThemeNonAsciiCompiled.tgt", "Label");
+        compareRenderers(expected->propertyValuePairs, actual->propertyValuePairs);
+        REQUIRE(loader->load("resources/ThemeNonAsciiCompiled.tgt", "Label") == defaultLoader->load("resources/ThemeNonAscii.txt", "Label"));
+    }
+
+    SECTION("load nonexistent file")
+    {
+        REQUIRE_THROWS_AS(loader->preload("resources/nonexistent.tgt"), tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::BinaryThemeLoader::compile("resources/nonexistent.txt", "resources/nonexistent.tgt"), tgui::Exception);
+    }
+
+    SECTION("load nonexistent section")
+    {
+        tgui::BinaryThemeLoader::compile("resources/Black.txt", "resources/BlackCompiled.tgt");
+        REQUIRE_THROWS_AS(loader->loadRenderer("resources/BlackCompiled.tgt", "NonexistentClassName"), tgui::Exception);
+        REQUIRE_THROWS_AS(loader->load("resources/BlackCompiled.tgt", "NonexistentClassName"), tgui::Exception);
+    }
+
+    SECTION("load invalid file")
+    {
+        // A text theme is not a binary theme
+        REQUIRE_THROWS_AS(loader->preload("resources/Black.txt"), tgui::Exception);
+
+        // Truncated file
+        tgui::BinaryThemeLoader::compile("resources/Black.txt", "resources/BlackCompiled.tgt");
+        std::string contents;
+        {
+            std::ifstream file{"resources/BlackCompiled.tgt", std::ios::binary};
+            contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+        {
+            std::ofstream file{"resources/BlackTruncated.tgt", std::ios::binary};
+            file.write(contents.data(), static_cast<std::streamsize>(contents.size() / 2));
+        }
+        REQUIRE_THROWS_AS(loader->preload("resources/BlackTruncated.tgt"), tgui::Exception);
+    }
+
+    SECTION("empty filename")
+    {
+        REQUIRE(loader->load("", "Button").empty());
+        REQUIRE(loader->loadRenderer("", "Button")->propertyValuePairs.empty());
+    }
+
+    SECTION("flushed while loading on other threads")
+    {
+        tgui::BinaryThemeLoader::compile("resources/Black.txt", "resources/BlackCompiled.tgt");
+        const auto expected = defaultLoader->load("resources/Black.txt", "Button");
+
+        const auto loadRepeatedly = [loader, expected]
+            {
+                for (unsigned int i = 0; i < 200; ++i)
+                {
+                    if (loader->load("resources/BlackCompiled.tgt", "Button") != expected)
+                        return false;
+                }
+                return true;
+            };
+
+        auto result1 = std::async(std::launch::async, loadRepeatedly);
+        auto result2 = std::async(std::launch::async, loadRepeatedly);
+        for (unsigned int i = 0; i < 200; ++i)
+            loader->flushCache();
+
+        REQUIRE(result1.get());
+        REQUIRE(result2.get());
+    }
+
+    SECTION("theme")
+    {
+        tgui::BinaryThemeLoader::compile("resources/Black.txt", "resources/BlackCompiled.tgt");
+        tgui::Theme::setThemeLoader(loader);
+
+        tgui::Theme theme{"resources/BlackCompiled.tgt"};
+        auto button = tgui::Button::create();
+        REQUIRE_NOTHROW(button->setRenderer(theme.getRenderer("Button")));
+        REQUIRE(button->getRenderer()->getTexture().getId() != "");
+
+        tgui::Theme::setThemeLoader(std::make_shared<tgui::DefaultThemeLoader>());
+    }
+}
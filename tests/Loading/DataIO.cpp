@@ -198,14 +198,155 @@ TEST_CASE("[DataIO]")
             std::stringstream input("{ Property = ; ");
             REQUIRE_THROWS_AS(tgui::DataIO::parse(input), tgui::Exception);
         }
+
+        SECTION("Buffer")
+        {
+            // The buffer doesn't have to be null-terminated
+            const std::string input = "Child {\n    Property = Value; // Comment\n    List = [a, \"b\"];\n}\nIgnored = Value;";
+            auto rootNode = tgui::DataIO::parse(input.data(), input.find("Ignored"));
+            REQUIRE(rootNode->propertyValuePairs.empty());
+            REQUIRE(rootNode->children.size() == 1);
+            REQUIRE(rootNode->children[0]->name == "Child");
+            REQUIRE(rootNode->children[0]->propertyValuePairs.size() == 2);
+            REQUIRE(rootNode->children[0]->propertyValuePairs["property"]->value == "Value");
+            REQUIRE(rootNode->children[0]->propertyValuePairs["list"]->valueList.size() == 2);
+            REQUIRE(rootNode->children[0]->propertyValuePairs["list"]->valueList[1] == "\"b\"");
+
+            REQUIRE(tgui::DataIO::parse(input.data(), 0)->children.empty());
+            REQUIRE_THROWS_AS(tgui::DataIO::parse(input.data(), 5), tgui::Exception);
+        }
+
+        SECTION("Line number in error")
+        {
+            std::stringstream input("A {\n    B = 1;\n    /* Multi\n       line */\n    C = ;\n}");
+            try
+            {
+                tgui::DataIO::parse(input);
+                FAIL("Parsing invalid input should throw");
+            }
+            catch (const tgui::Exception& e)
+            {
+                REQUIRE(std::string(e.what()).find("at line 5.") != std::string::npos);
+            }
+        }
+
+        SECTION("Binary")
+        {
+            std::stringstream input("Child { Property = Value; }");
+            std::stringstream binaryStream;
+            tgui::DataIO::emitBinary(tgui::DataIO::parse(input), binaryStream);
+            const std::string binary = binaryStream.str();
+
+            REQUIRE(tgui::DataIO::isBinary(binary.data(), binary.size()));
+            REQUIRE(!tgui::DataIO::isBinary(input.str().data(), input.str().size()));
+            REQUIRE(!tgui::DataIO::isBinary(binary.data(), 3));
+            REQUIRE_NOTHROW(tgui::DataIO::parseBinary(binary.data(), binary.size()));
+
+            REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(input.str().data(), input.str().size()), tgui::Exception);
+            REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(binary.data(), binary.size() - 1), tgui::Exception);
+            REQUIRE_THROWS_AS(tgui::DataIO::parseBinary((binary + '\0').data(), binary.size() + 1), tgui::Exception);
+
+            std::string wrongVersion = binary;
+            wrongVersion[4] = static_cast<char>(wrongVersion[4] + 1);
+            REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(wrongVersion.data(), wrongVersion.size()), tgui::Exception);
+        }
+
+        SECTION("Binary matches text")
+        {
+            auto root = std::make_unique<tgui::DataIO::Node>();
+            root->propertyValuePairs["MixedCase"] = std::make_unique<tgui::DataIO::ValueNode>("  A \t B  \"  quoted \t \"  C  ");
+            root->propertyValuePairs["List"] = std::make_unique<tgui::DataIO::ValueNode>("[1,   \"a,  b\" ]");
+
+            std::stringstream textStream;
+            tgui::DataIO::emit(root, textStream);
+            const auto textRoot = tgui::DataIO::parse(textStream);
+
+            std::stringstream binaryStream;
+            tgui::DataIO::emitBinary(root, binaryStream);
+            const std::string binary = binaryStream.str();
+            const auto binaryRoot = tgui::DataIO::parseBinary(binary.data(), binary.size());
+
+            REQUIRE(binaryRoot->propertyValuePairs.size() == 2);
+            for (const auto& pair : textRoot->propertyValuePairs)
+            {
+                REQUIRE(binaryRoot->propertyValuePairs.find(pair.first) != binaryRoot->propertyValuePairs.end());
+                const auto& binaryValue = binaryRoot->propertyValuePairs[pair.first];
+                REQUIRE(binaryValue->value == pair.second->value);
+                REQUIRE(binaryValue->listNode == pair.second->listNode);
+                REQUIRE(binaryValue->valueList == pair.second->valueList);
+            }
+        }
+
+        SECTION("Binary non-ASCII values")
+        {
+            const std::string utf8 = "Caf\xC3\xA9 \xE2\x82\xAC";
+            const sf::String value = sf::String::fromUtf8(utf8.begin(), utf8.end());
+
+            auto root = std::make_unique<tgui::DataIO::Node>();
+            root->propertyValuePairs["Text"] = std::make_unique<tgui::DataIO::ValueNode>("\"" + value + "\"");
+            root->propertyValuePairs["List"] = std::make_unique<tgui::DataIO::ValueNode>("[" + value + ", X]");
+
+            std::stringstream binaryStream;
+            tgui::DataIO::emitBinary(root, binaryStream);
+            const std::string binary = binaryStream.str();
+            const auto binaryRoot = tgui::DataIO::parseBinary(binary.data(), binary.size());
+
+            REQUIRE(binaryRoot->propertyValuePairs["text"]->value == "\"" + value + "\"");
+            REQUIRE(binaryRoot->propertyValuePairs["list"]->valueList.size() == 2);
+            REQUIRE(binaryRoot->propertyValuePairs["list"]->valueList[0] == value);
+        }
+
+        SECTION("Binary nested too deeply")
+        {
+            const auto appendUint32 = [](std::string& str, std::uint32_t value) {
+                    for (unsigned int i = 0; i < 4; ++i)
+                        str.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+                };
+
+            // Magic and version, followed by a single empty string which is used as the name of every node
+            std::stringstream emptyStream;
+            tgui::DataIO::emitBinary(std::make_unique<tgui::DataIO::Node>(), emptyStream);
+            std::string binary = emptyStream.str().substr(0, 8);
+            appendUint32(binary, 1);
+            appendUint32(binary, 0);
+
+            const auto createNestedNodes = [&](unsigned int depth) {
+                    std::string data = binary;
+                    for (unsigned int i = 0; i < depth; ++i)
+                    {
+                        appendUint32(data, 0); // Name
+                        appendUint32(data, 0); // Property count
+                        appendUint32(data, (i < depth - 1) ? 1 : 0); // Child count
+                    }
+                    return data;
+                };
+
+            const std::string validNodes = createNestedNodes(200);
+            REQUIRE_NOTHROW(tgui::DataIO::parseBinary(validNodes.data(), validNodes.size()));
+
+            const std::string nestedNodes = createNestedNodes(100000);
+            REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(nestedNodes.data(), nestedNodes.size()), tgui::Exception);
+
+            // Such a tree can't be written either
+            auto root = std::make_unique<tgui::DataIO::Node>();
+            tgui::DataIO::Node* node = root.get();
+            for (unsigned int i = 0; i < 300; ++i)
+            {
+                node->children.push_back(std::make_unique<tgui::DataIO::Node>());
+                node->children.back()->parent = node;
+                node = node->children.back().get();
+            }
+
+            std::stringstream nestedStream;
+            REQUIRE_THROWS_AS(tgui::DataIO::emitBinary(root, nestedStream), tgui::Exception);
+        }
     }
 
     SECTION("correct input")
     {
         std::stringstream stream;
 
-        SECTION("emit")
-        {
+        auto createTree = []{
             auto root = std::make_unique<tgui::DataIO::Node>();
             root->name = "Root";
             root->propertyValuePairs["GlobalProperty1"] = std::make_unique<tgui::DataIO::ValueNode>("GlobalValue1");
@@ -230,7 +371,22 @@ TEST_CASE("[DataIO]")
             root->children.push_back(std::move(child1));
             root->children.push_back(std::move(child2));
 
-            tgui::DataIO::emit(root, stream);
+            return root;
+        };
+
+        SECTION("emit")
+        {
+            tgui::DataIO::emit(createTree(), stream);
+        }
+
+        SECTION("binary from nodes")
+        {
+            // The tree is written directly, without being converted to text first
+            std::stringstream binaryStream;
+            tgui::DataIO::emitBinary(createTree(), binaryStream);
+
+            const std::string binary = binaryStream.str();
+            tgui::DataIO::emit(tgui::DataIO::parseBinary(binary.data(), binary.size()), stream);
         }
 
         SECTION("direct stream")
@@ -251,6 +407,20 @@ TEST_CASE("[DataIO]")
             stream << "}" << std::endl;
         }
 
+        SECTION("binary")
+        {
+            std::stringstream input;
+            input << "GlobalProperty1 = GlobalValue1; GlobalProperty2 = GlobalValue2;" << std::endl;
+            input << "Child1 { Property = Value; NestedChild { PropertyA = ValueA; PropertyB = []; PropertyC = [X, Y, Z]; } }" << std::endl;
+            input << "{ }" << std::endl;
+
+            std::stringstream binaryStream;
+            tgui::DataIO::emitBinary(tgui::DataIO::parse(input), binaryStream);
+
+            const std::string binary = binaryStream.str();
+            tgui::DataIO::emit(tgui::DataIO::parseBinary(binary.data(), binary.size()), stream);
+        }
+
         // Check that emit function works correctly be parsing the result and check if it equals the input
         auto parsedRoot = tgui::DataIO::parse(stream);
         REQUIRE(parsedRoot->name == ""); // Root node name is ignored when saving
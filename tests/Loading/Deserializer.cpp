@@ -204,4 +204,67 @@ TEST_CASE("[Deserializer]")
         tgui::Deserializer::setFunction(tgui::ObjectConverter::Type::Color, oldFunc);
         REQUIRE(tgui::Deserializer::deserialize(Type::Color, "rgb(10, 20, 30)").getColor() == sf::Color(10, 20, 30));
     }
+
+    SECTION("cache")
+    {
+        REQUIRE(tgui::Deserializer::isCacheEnabled());
+        tgui::Deserializer::clearCache();
+        REQUIRE(tgui::Deserializer::getCacheHits() == 0);
+        REQUIRE(tgui::Deserializer::getCacheMisses() == 0);
+
+        REQUIRE(tgui::Deserializer::deserialize(Type::Color, "rgb(1, 2, 3)").getColor() == sf::Color(1, 2, 3));
+        REQUIRE(tgui::Deserializer::getCacheMisses() == 1);
+        REQUIRE(tgui::Deserializer::deserialize(Type::Color, "rgb(1, 2, 3)").getColor() == sf::Color(1, 2, 3));
+        REQUIRE(tgui::Color("rgb(1, 2, 3)") == sf::Color(1, 2, 3));
+        REQUIRE(tgui::Deserializer::getCacheHits() == 2);
+        REQUIRE(tgui::Deserializer::getCacheMisses() == 1);
+
+        // The same string is cached separately for different types
+        REQUIRE(tgui::Deserializer::deserialize(Type::Number, "5").getNumber() == 5);
+        REQUIRE(tgui::Deserializer::deserialize(Type::String, "5").getString() == "5");
+        REQUIRE(tgui::Deserializer::getCacheMisses() == 3);
+
+        // Fonts loaded from the same file are shared
+        auto font1 = tgui::Deserializer::deserialize(Type::Font, "resources/DejaVuSans.ttf").getFont();
+        auto font2 = tgui::Deserializer::deserialize(Type::Font, "resources/DejaVuSans.ttf").getFont();
+        REQUIRE(font1 != nullptr);
+        REQUIRE(font1 == font2);
+
+        // Renderer data is mutable and is thus never shared
+        auto data1 = tgui::Deserializer::deserialize(Type::RendererData, "{ num = 5; }").getRenderer();
+        auto data2 = tgui::Deserializer::deserialize(Type::RendererData, "{ num = 5; }").getRenderer();
+        REQUIRE(data1 != data2);
+
+        // Invalid values are not cached
+        const auto misses = tgui::Deserializer::getCacheMisses();
+        REQUIRE_THROWS_AS(tgui::Deserializer::deserialize(Type::Color, "rgb(1, 2)"), tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::Deserializer::deserialize(Type::Color, "rgb(1, 2)"), tgui::Exception);
+
+        REQUIRE(tgui::Deserializer::getCacheMisses() == misses);
+
+        // A type is no longer cached after its cache was cleared
+        tgui::Deserializer::clearCache(Type::Font);
+        REQUIRE(tgui::Deserializer::deserialize(Type::Font, "resources/DejaVuSans.ttf").getFont().getFont() != font1.getFont());
+        REQUIRE(tgui::Deserializer::getCacheMisses() == misses + 1);
+
+        // The cache doesn't grow indefinitely
+        tgui::Deserializer::clearCache();
+        for (unsigned int i = 0; i < 1000; ++i)
+            tgui::Deserializer::deserialize(Type::Number, tgui::to_string(i));
+        REQUIRE(tgui::Deserializer::getCacheMisses() == 1000);
+        tgui::Deserializer::deserialize(Type::Number, "0");
+        REQUIRE(tgui::Deserializer::getCacheHits() == 1);
+        tgui::Deserializer::deserialize(Type::Number, "1000");
+        tgui::Deserializer::deserialize(Type::Number, "0");
+        REQUIRE(tgui::Deserializer::getCacheHits() == 1);
+        REQUIRE(tgui::Deserializer::getCacheMisses() == 1002);
+
+        tgui::Deserializer::setCacheEnabled(false);
+        REQUIRE(!tgui::Deserializer::isCacheEnabled());
+        REQUIRE(tgui::Deserializer::deserialize(Type::Color, "rgb(1, 2, 3)").getColor() == sf::Color(1, 2, 3));
+        REQUIRE(tgui::Deserializer::getCacheHits() == 0);
+        REQUIRE(tgui::Deserializer::getCacheMisses() == 0);
+
+        tgui::Deserializer::setCacheEnabled(true);
+    }
 }
@@ -0,0 +1,235 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "../Tests.hpp"
+#include <TGUI/Loading/ResourcePack.hpp>
+#include <TGUI/Loading/BinaryThemeLoader.hpp>
+#include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Gui.hpp>
+#include <fstream>
+#include <future>
+
+namespace
+{
+    std::string readFile(const std::string& filename)
+    {
+        std::ifstream file{filename, std::ios::binary};
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+}
+
+TEST_CASE("[ResourcePack]")
+{
+    {
+        std::ofstream file{"ResourcePackForm.txt"};
+        file << "Button.PackedButton {\n    Text = \"Packed\";\n}\n";
+    }
+
+    tgui::BinaryThemeLoader::compile("resources/ThemeButton1.txt", "ResourcePackTheme.tgt");
+    tgui::ResourcePack::create("ResourcePack.tgp", {"resources/ThemeButton1.txt", "resources/image.png", "resources/DejaVuSans.ttf", "ResourcePackForm.txt", "ResourcePackTheme.tgt"});
+    auto pack = std::make_shared<tgui::ResourcePack>("ResourcePack.tgp");
+
+    SECTION("contents")
+    {
+        REQUIRE(pack->getFilenames() == std::vector<std::string>({"resources/ThemeButton1.txt", "resources/image.png", "resources/DejaVuSans.ttf", "ResourcePackForm.txt", "ResourcePackTheme.tgt"}));
+
+        std::size_t size = 0;
+        const char* data = pack->getFile("resources/image.png", size);
+        REQUIRE(data != nullptr);
+        REQUIRE(std::string(data, size) == readFile("resources/image.png"));
+
+        data = pack->getFile("resources/ThemeButton1.txt", size);
+        REQUIRE(data != nullptr);
+        REQUIRE(std::string(data, size) == readFile("resources/ThemeButton1.txt"));
+
+        REQUIRE(pack->getFile("resources/nonexistent.png", size) == nullptr);
+
+        // Different spellings of the same path are accepted
+        REQUIRE(pack->contains("./resources/image.png"));
+        REQUIRE(pack->contains("resources\\image.png"));
+        REQUIRE(pack->contains("widgets/../resources/image.png"));
+        REQUIRE(!pack->contains("image.png"));
+    }
+
+    SECTION("mounted")
+    {
+        // The files only exist with this prefix inside the pack, so they can't be loaded from disk by accident
+        tgui::ResourcePack::mount(pack, "packed");
+
+        const char* data = nullptr;
+        std::size_t size = 0;
+        REQUIRE(tgui::ResourcePack::findMountedFile("packed/resources/image.png", data, size) == pack);
+        REQUIRE(std::string(data, size) == readFile("resources/image.png"));
+        REQUIRE(tgui::ResourcePack::findMountedFile("resources/image.png", data, size) == nullptr);
+
+        SECTION("theme")
+        {
+            tgui::Theme theme{"packed/resources/ThemeButton1.txt"};
+            REQUIRE(theme.getRenderer("Button1")->propertyValuePairs["textcolor"].getColor() == sf::Color(255, 255, 0));
+            tgui::DefaultThemeLoader::flushCache("packed/resources/ThemeButton1.txt");
+        }
+
+        SECTION("binary theme")
+        {
+            tgui::BinaryThemeLoader loader;
+            REQUIRE(tgui::ObjectConverter{loader.loadRenderer("packed/ResourcePackTheme.tgt", "Button1")->propertyValuePairs.at("textcolor")}.getColor() == sf::Color(255, 255, 0));
+        }
+
+        SECTION("form")
+        {
+            tgui::Gui gui;
+            REQUIRE_NOTHROW(gui.loadWidgetsFromFile("packed/ResourcePackForm.txt"));
+            REQUIRE(gui.get<tgui::Button>("PackedButton") != nullptr);
+            REQUIRE(gui.get<tgui::Button>("PackedButton")->getText() == "Packed");
+        }
+
+        SECTION("texture")
+        {
+            tgui::Texture texture{"packed/resources/image.png"};
+            REQUIRE(texture.getData() != nullptr);
+            REQUIRE(texture.getImageSize() == sf::Vector2f(50, 50));
+        }
+
+        SECTION("font")
+        {
+            tgui::Font font{"packed/resources/DejaVuSans.ttf"};
+            REQUIRE(font != nullptr);
+
+            REQUIRE_THROWS_AS(tgui::Font{"packed/resources/ThemeButton1.txt"}, tgui::Exception);
+        }
+
+        SECTION("remounting")
+        {
+            auto oldFont = tgui::Font{"packed/resources/DejaVuSans.ttf"}.getFont();
+            REQUIRE(tgui::Font{"packed/resources/DejaVuSans.ttf"}.getFont() == oldFont);
+
+            tgui::ResourcePack::unmount(pack);
+            auto newPack = std::make_shared<tgui::ResourcePack>("ResourcePack.tgp");
+            tgui::ResourcePack::mount(newPack, "packed");
+
+            // The font is loaded from the new pack instead of being taken from the cache
+            auto newFont = tgui::Font{"packed/resources/DejaVuSans.ttf"}.getFont();
+            REQUIRE(newFont != nullptr);
+            REQUIRE(newFont != oldFont);
+
+            // The unmounted pack is no longer kept alive once its fonts are released
+            oldFont = nullptr;
+            REQUIRE(pack.use_count() == 1);
+
+            tgui::ResourcePack::unmount(newPack);
+            tgui::ResourcePack::mount(pack, "packed");
+        }
+
+        SECTION("mounting while loading on another thread")
+        {
+            auto findRepeatedly = std::async(std::launch::async, []
+                {
+                    const char* packedData;
+                    std::size_t packedSize;
+                    for (unsigned int i = 0; i < 1000; ++i)
+                    {
+                        const auto foundPack = tgui::ResourcePack::findMountedFile("packed/resources/image.png", packedData, packedSize);
+                        if (foundPack && (foundPack->getFile("resources/image.png", packedSize) != packedData))
+                            return false;
+                    }
+                    return true;
+                });
+
+            for (unsigned int i = 0; i < 1000; ++i)
+            {
+                tgui::ResourcePack::unmount(pack);
+                tgui::ResourcePack::mount(pack, "packed");
+            }
+
+            REQUIRE(findRepeatedly.get());
+        }
+
+        // Unmounting doesn't invalidate resources that were already loaded
+        tgui::ResourcePack::unmount(pack);
+        REQUIRE(tgui::ResourcePack::findMountedFile("packed/resources/image.png", data, size) == nullptr);
+        REQUIRE_THROWS_AS(tgui::Gui().loadWidgetsFromFile("packed/ResourcePackForm.txt"), tgui::Exception);
+    }
+
+    SECTION("resource path")
+    {
+        // Files are stored and looked up by their name relative to the resource path
+        tgui::setResourcePath("resources");
+        {
+            std::ofstream file{"resources/ResourcePackForm.txt"};
+            file << "Button.PackedButton {\n    Text = \"Packed\";\n}\n";
+        }
+        tgui::BinaryThemeLoader::compile("ThemeButton1.txt", "ResourcePackTheme.tgt");
+        tgui::ResourcePack::create("ResourcePackRelative.tgp", {"ThemeButton1.txt", "image.png", "ResourcePackForm.txt", "ResourcePackTheme.tgt"});
+
+        auto relativePack = std::make_shared<tgui::ResourcePack>("ResourcePackRelative.tgp");
+        REQUIRE(relativePack->getFilenames() == std::vector<std::string>({"ThemeButton1.txt", "image.png", "ResourcePackForm.txt", "ResourcePackTheme.tgt"}));
+        tgui::ResourcePack::mount(relativePack, "packed");
+
+        // Full filenames, as the image loader receives them, are found as well
+        const char* data = nullptr;
+        std::size_t size = 0;
+        REQUIRE(tgui::ResourcePack::findMountedFile("packed/image.png", data, size) == relativePack);
+        REQUIRE(tgui::ResourcePack::findMountedFile("resources/packed/image.png", data, size) == relativePack);
+        REQUIRE(tgui::ResourcePack::findMountedFile("./resources/packed/image.png", data, size) == relativePack);
+        REQUIRE(tgui::ResourcePack::findMountedFile("resources/image.png", data, size) == nullptr);
+
+        tgui::Theme theme{"packed/ThemeButton1.txt"};
+        REQUIRE(theme.getRenderer("Button1")->propertyValuePairs["textcolor"].getColor() == sf::Color(255, 255, 0));
+        tgui::DefaultThemeLoader::flushCache("packed/ThemeButton1.txt");
+
+        tgui::BinaryThemeLoader loader;
+        REQUIRE(tgui::ObjectConverter{loader.loadRenderer("packed/ResourcePackTheme.tgt", "Button1")->propertyValuePairs.at("textcolor")}.getColor() == sf::Color(255, 255, 0));
+
+        tgui::Gui gui;
+        REQUIRE_NOTHROW(gui.loadWidgetsFromFile("packed/ResourcePackForm.txt"));
+        REQUIRE(gui.get<tgui::Button>("PackedButton") != nullptr);
+
+        const auto texture = tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Texture, "\"packed/image.png\"").getTexture();
+        REQUIRE(texture.getData() != nullptr);
+        REQUIRE(texture.getImageSize() == sf::Vector2f(50, 50));
+
+        tgui::ResourcePack::unmount(relativePack);
+        tgui::setResourcePath("");
+    }
+
+    SECTION("invalid files")
+    {
+        REQUIRE_THROWS_AS(tgui::ResourcePack("nonexistent.tgp"), tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::ResourcePack("resources/ThemeButton1.txt"), tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::ResourcePack::create("ResourcePack2.tgp", {"resources/nonexistent.png"}), tgui::Exception);
+
+        // Truncated pack
+        const std::string contents = readFile("ResourcePack.tgp");
+        {
+            std::ofstream file{"ResourcePackTruncated.tgp", std::ios::binary};
+            file.write(contents.data(), static_cast<std::streamsize>(contents.size() / 2));
+        }
+        REQUIRE_THROWS_AS(tgui::ResourcePack("ResourcePackTruncated.tgp"), tgui::Exception);
+    }
+
+    tgui::ResourcePack::unmountAll();
+}
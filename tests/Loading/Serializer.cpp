@@ -99,6 +99,12 @@ TEST_CASE("[Serializer]")
         REQUIRE(tgui::Serializer::serialize({0}) == "0");
         REQUIRE(tgui::Serializer::serialize({1}) == "1");
         REQUIRE(tgui::Serializer::serialize({2.15f}) == "2.15");
+        REQUIRE(tgui::Serializer::serialize({-35}) == "-35");
+        REQUIRE(tgui::Serializer::serialize({-0.f}) == "-0");
+        REQUIRE(tgui::Serializer::serialize({0.1f}) == "0.1");
+        REQUIRE(tgui::Serializer::serialize({999999}) == "999999");
+        REQUIRE(tgui::Serializer::serialize({1000000}) == "1e+06");
+        REQUIRE(tgui::Serializer::serialize({1.5e-7f}) == "1.5e-07");
     }
 
     SECTION("serialize text style")
@@ -25,8 +25,9 @@
 #include "../Tests.hpp"
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/Label.hpp>
-
-// TODO: Reloading theme
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <atomic>
 
 TEST_CASE("[Theme]")
 {
@@ -122,6 +123,63 @@ TEST_CASE("[Theme]")
             REQUIRE(tgui::LabelRenderer(theme.getRenderer("label")).getTextColor() == defaultColor);
             REQUIRE(theme.getRenderer("label")->propertyValuePairs["textcolor"].getColor() == defaultColor);
         }
+
+        SECTION("With other themes")
+        {
+            // Every theme has its own copy of the renderers that are shared by the theme loader, including the nested ones
+            tgui::Theme otherTheme{"resources/Black.txt"};
+            theme.getRenderer("label")->propertyValuePairs["textcolor"] = {sf::Color::Cyan};
+            REQUIRE(otherTheme.getRenderer("label")->propertyValuePairs["textcolor"].getColor() != sf::Color::Cyan);
+
+            auto scrollbar = theme.getRenderer("listbox")->propertyValuePairs["scrollbar"].getRenderer();
+            REQUIRE(!scrollbar->copyOnWrite);
+            scrollbar->propertyValuePairs["texturetrack"] = {sf::String{"None"}};
+            REQUIRE(otherTheme.getRenderer("listbox")->propertyValuePairs["scrollbar"].getRenderer()->propertyValuePairs["texturetrack"].getString() != "None");
+        }
+    }
+
+    SECTION("Reloading")
+    {
+        struct CustomThemeLoader : public tgui::BaseThemeLoader
+        {
+            void preload(const std::string&) override
+            {
+            }
+
+            const std::map<sf::String, sf::String>& load(const std::string& primary, const std::string&) override
+            {
+                return themes[primary];
+            }
+
+            std::map<std::string, std::map<sf::String, sf::String>> themes;
+        };
+
+        auto loader = std::make_shared<CustomThemeLoader>();
+        loader->themes["theme1"] = {{"textcolor", "Red"}, {"backgroundcolor", "Green"}, {"borders", "(1, 2, 3, 4)"}};
+        loader->themes["theme2"] = {{"textcolor", "Red"}, {"backgroundcolor", "Blue"}, {"padding", "(5, 6, 7, 8)"}};
+        tgui::Theme::setThemeLoader(loader);
+
+        tgui::Theme theme{"theme1"};
+        auto label = tgui::Label::create();
+        label->setRenderer(theme.getRenderer("label"));
+
+        std::set<std::string> changedProperties;
+        label->getRenderer()->subscribe(&changedProperties, [&](const std::string& property){ changedProperties.insert(property); });
+
+        theme.load("theme1");
+        REQUIRE(theme.getChangedPropertyCount() == 0);
+        REQUIRE(changedProperties.empty());
+
+        theme.load("theme2");
+        REQUIRE(theme.getChangedPropertyCount() == 3);
+        REQUIRE(changedProperties == std::set<std::string>({"backgroundcolor", "borders", "padding"}));
+        REQUIRE(label->getRenderer()->getTextColor() == sf::Color::Red);
+        REQUIRE(label->getRenderer()->getBackgroundColor() == sf::Color::Blue);
+        REQUIRE(label->getRenderer()->getPadding() == tgui::Padding(5, 6, 7, 8));
+        REQUIRE(label->getRenderer()->getPropertyValuePairs().count("borders") == 0);
+
+        label->getRenderer()->unsubscribe(&changedProperties);
+        tgui::Theme::setThemeLoader(std::make_shared<tgui::DefaultThemeLoader>());
     }
 
     SECTION("setThemeLoader")
@@ -169,4 +227,49 @@ TEST_CASE("[Theme]")
         REQUIRE(loader->preloadCount == 1);
         REQUIRE(loader->loadCount == 2);
     }
+
+    SECTION("preloadAsync")
+    {
+        tgui::DefaultThemeLoader::flushCache();
+        tgui::TextureManager::clearPreloadedImages();
+
+        static std::atomic<unsigned int> imageLoadCount{0};
+        imageLoadCount = 0;
+
+        const auto oldImageLoader = tgui::Texture::getImageLoader();
+        tgui::Texture::setImageLoader([](const sf::String& filename)
+            {
+                ++imageLoadCount;
+                auto image = std::make_unique<sf::Image>();
+                if (image->loadFromFile(filename))
+                    return image;
+                else
+                    return std::unique_ptr<sf::Image>();
+            });
+
+        auto themeReady = tgui::Theme::preloadAsync("resources/Black.txt");
+        REQUIRE_NOTHROW(themeReady.get());
+        REQUIRE(imageLoadCount > 0);
+
+        // The images were already decoded, so only the textures have to be created
+        const unsigned int preloadedImageCount = imageLoadCount;
+        tgui::Theme theme{"resources/Black.txt"};
+        auto button = tgui::Button::create();
+        button->setRenderer(theme.getRenderer("Button"));
+        REQUIRE(button->getRenderer()->getTexture().getData() != nullptr);
+        REQUIRE(imageLoadCount == preloadedImageCount);
+
+        REQUIRE_THROWS_AS(tgui::Theme::preloadAsync("resources/nonexistent.txt").get(), tgui::Exception);
+
+        // Errors thrown while decoding the images are passed on as well
+        tgui::TextureManager::clearPreloadedImages();
+        tgui::Texture::setImageLoader([](const sf::String&) -> std::unique_ptr<sf::Image>
+            {
+                throw tgui::Exception{"Failed to decode image"};
+            });
+        REQUIRE_THROWS_AS(tgui::Theme::preloadAsync("resources/Black.txt").get(), tgui::Exception);
+
+        tgui::Texture::setImageLoader(oldImageLoader);
+        tgui::TextureManager::clearPreloadedImages();
+    }
 }
@@ -24,6 +24,7 @@
 
 #include "../Tests.hpp"
 #include <TGUI/Loading/ThemeLoader.hpp>
+#include <future>
 
 // Ignore warning "C4503: decorated name length exceeded, name was truncated" in Visual Studio
 #if defined _MSC_VER
@@ -35,6 +36,7 @@ namespace tgui
     struct DefaultThemeLoaderTest
     {
         static auto& getPropertiesCache(std::shared_ptr<DefaultThemeLoader> loader) { return loader->m_propertiesCache; }
+        static auto& getRenderersCache(std::shared_ptr<DefaultThemeLoader> loader) { return loader->m_renderersCache; }
     };
 }
 
@@ -76,6 +78,7 @@ TEST_CASE("[ThemeLoader]")
 
     SECTION("load theme with nested sections")
     {
+        // Nested sections are returned in the same form, no matter whether they were referenced or written inside the section
         std::map<sf::String, sf::String> properties = loader->load("resources/ThemeNested.txt", "ListBox1");
         REQUIRE(properties.size() == 2);
         REQUIRE(properties["backgroundcolor"] == "White");
@@ -91,69 +94,122 @@ TEST_CASE("[ThemeLoader]")
 
         properties = loader->load("resources/ThemeNested.txt", "ComboBox1");
         REQUIRE(properties.size() == 1);
-        REQUIRE(properties["listbox"] == "{\nbackgroundcolor = White;\nscrollbar = {\nthumbcolor = Green;\ntrackcolor = Red;\n};\n}");
+        REQUIRE(properties["listbox"] == "{\nbackgroundcolor = White;\n\nscrollbar {\n    thumbcolor = Green;\n    trackcolor = Red;\n}\n}");
 
         properties = loader->load("resources/ThemeNested.txt", "ComboBox2");
         REQUIRE(properties.size() == 1);
-        REQUIRE(properties["listbox"] == "{\nScrollbar {\n    thumbcolor = Blue;\n}\n}");
+        REQUIRE(properties["listbox"] == "{\nscrollbar {\n    thumbcolor = Blue;\n}\n}");
 
         properties = loader->load("resources/ThemeNested.txt", "ComboBox3");
         REQUIRE(properties.size() == 1);
-        REQUIRE(properties["listbox"] == "{\nScrollbar {\n    trackcolor = Yellow;\n}\n}");
+        REQUIRE(properties["listbox"] == "{\nscrollbar {\n    trackcolor = Yellow;\n}\n}");
 
         properties = loader->load("resources/ThemeNested.txt", "ComboBox4");
         REQUIRE(properties.size() == 1);
-        REQUIRE(properties["listbox"] == "{\nbackgroundcolor = Magenta;\nscrollbar = {\nthumbcolor = Green;\ntrackcolor = Red;\n};\n}");
+        REQUIRE(properties["listbox"] == "{\nbackgroundcolor = Magenta;\n\nscrollbar {\n    thumbcolor = Green;\n    trackcolor = Red;\n}\n}");
 
         properties = loader->load("resources/ThemeNested.txt", "ComboBox5");
         REQUIRE(properties.size() == 1);
-        REQUIRE(properties["listbox"] == "{\nbackgroundcolor = Cyan;\n\nScrollbar {\n    trackcolor = Black;\n}\n}");
+        REQUIRE(properties["listbox"] == "{\nbackgroundcolor = Cyan;\n\nscrollbar {\n    trackcolor = Black;\n}\n}");
+    }
+
+    SECTION("load renderer with nested sections")
+    {
+        std::map<std::string, tgui::ObjectConverter> properties = loader->loadRenderer("resources/ThemeNested.txt", "ListBox1")->propertyValuePairs;
+        REQUIRE(properties.size() == 2);
+        REQUIRE(properties["backgroundcolor"].getColor() == sf::Color::White);
+        REQUIRE(properties["scrollbar"].getType() == tgui::ObjectConverter::Type::RendererData);
+        REQUIRE(properties["scrollbar"].getRenderer()->propertyValuePairs.size() == 2);
+        REQUIRE(properties["scrollbar"].getRenderer()->propertyValuePairs["thumbcolor"].getColor() == sf::Color::Green);
+        REQUIRE(properties["scrollbar"].getRenderer()->propertyValuePairs["trackcolor"].getColor() == sf::Color::Red);
+
+        properties = loader->loadRenderer("resources/ThemeNested.txt", "ComboBox4")->propertyValuePairs;
+        REQUIRE(properties.size() == 1);
+        REQUIRE(properties["listbox"].getType() == tgui::ObjectConverter::Type::RendererData);
+        auto& listBoxProperties = properties["listbox"].getRenderer()->propertyValuePairs;
+        REQUIRE(listBoxProperties.size() == 2);
+        REQUIRE(listBoxProperties["backgroundcolor"].getColor() == sf::Color::Magenta);
+        REQUIRE(listBoxProperties["scrollbar"].getType() == tgui::ObjectConverter::Type::RendererData);
+        REQUIRE(listBoxProperties["scrollbar"].getRenderer()->propertyValuePairs["thumbcolor"].getColor() == sf::Color::Green);
+
+        properties = loader->loadRenderer("resources/ThemeNested.txt", "ComboBox5")->propertyValuePairs;
+        REQUIRE(properties["listbox"].getRenderer()->propertyValuePairs["scrollbar"].getRenderer()->propertyValuePairs["trackcolor"].getColor() == sf::Color::Black);
+
+        // Every call returns the same copy-on-write data
+        auto renderer1 = loader->loadRenderer("resources/ThemeNested.txt", "ListBox2");
+        auto renderer2 = loader->loadRenderer("resources/ThemeNested.txt", "ListBox2");
+        REQUIRE(renderer1 == renderer2);
+        REQUIRE(renderer1->copyOnWrite);
+        REQUIRE(renderer1->propertyValuePairs["scrollbar"].getRenderer()->copyOnWrite);
+
+        // Sections that reference the same section share its renderer
+        auto listBoxRenderer = loader->loadRenderer("resources/ThemeNested.txt", "ListBox1");
+        auto comboBoxRenderer = loader->loadRenderer("resources/ThemeNested.txt", "ComboBox1");
+        REQUIRE(comboBoxRenderer->propertyValuePairs["listbox"].getRenderer() == listBoxRenderer);
+        REQUIRE(listBoxRenderer->propertyValuePairs["scrollbar"].getRenderer() == loader->loadRenderer("resources/ThemeNested.txt", "ScrollbarSection"));
+
+        REQUIRE_THROWS_AS(loader->loadRenderer("resources/ThemeNested.txt", "NonexistentClassName"), tgui::Exception);
     }
 
     SECTION("cache")
     {
+        REQUIRE(tgui::DefaultThemeLoaderTest::getRenderersCache(loader).size() == 0);
         REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 0);
 
+        const auto getValue = [](const std::map<std::string, std::shared_ptr<tgui::RendererData>>& cache, const std::string& section, const std::string& property)
+            {
+                return tgui::ObjectConverter{cache.at(section)->propertyValuePairs.at(property)}.getString();
+            };
+
         SECTION("with preload")
         {
             loader->preload("resources/ThemeSpecialCases.txt");
             loader->preload("resources/ThemeButton1.txt");
 
+            // Preloading only creates the renderers, the properties are converted to strings when they are first loaded
+            auto& renderersCache = tgui::DefaultThemeLoaderTest::getRenderersCache(loader);
             auto& propertyCache = tgui::DefaultThemeLoaderTest::getPropertiesCache(loader);
-            REQUIRE(propertyCache.size() == 2);
+            REQUIRE(renderersCache.size() == 2);
+            REQUIRE(propertyCache.size() == 0);
 
-            auto& cache1 = propertyCache["resources/ThemeSpecialCases.txt"];
-            auto& cache2 = propertyCache["resources/ThemeButton1.txt"];
+            auto& cache1 = renderersCache["resources/ThemeSpecialCases.txt"];
+            auto& cache2 = renderersCache["resources/ThemeButton1.txt"];
             REQUIRE(cache1.size() == 4);
-            REQUIRE(cache1["button1"].size() == 1);
-            REQUIRE(cache1["button1"]["textcolor"] == "rgb(255, 0, 0)");
-            REQUIRE(cache1["name.with.dots"].size() == 2);
-            REQUIRE(cache1["name.with.dots"]["textcolor"] == "rgb(0, 255, 0)");
-            REQUIRE(cache1["name.with.dots"]["backgroundcolor"] == "rgb(255, 255, 255)");
-            REQUIRE(cache1["specialchars.{}=:;/*#//\t\\\""].size() == 1);
-            REQUIRE(cache1["specialchars.{}=:;/*#//\t\\\""]["textcolor"] == "rgba(,,,)");
-            REQUIRE(cache1["label"].size() == 1);
-            REQUIRE(cache1["label"]["textcolor"] == "rgb(0, 0, 255)");
+            REQUIRE(cache1["button1"]->propertyValuePairs.size() == 1);
+            REQUIRE(getValue(cache1, "button1", "textcolor") == "rgb(255, 0, 0)");
+            REQUIRE(cache1["name.with.dots"]->propertyValuePairs.size() == 2);
+            REQUIRE(getValue(cache1, "name.with.dots", "textcolor") == "rgb(0, 255, 0)");
+            REQUIRE(getValue(cache1, "name.with.dots", "backgroundcolor") == "rgb(255, 255, 255)");
+            REQUIRE(cache1["specialchars.{}=:;/*#//\t\\\""]->propertyValuePairs.size() == 1);
+            REQUIRE(getValue(cache1, "specialchars.{}=:;/*#//\t\\\"", "textcolor") == "rgba(,,,)");
+            REQUIRE(cache1["label"]->propertyValuePairs.size() == 1);
+            REQUIRE(getValue(cache1, "label", "textcolor") == "rgb(0, 0, 255)");
             REQUIRE(cache2.size() == 1);
-            REQUIRE(cache2["button1"].size() == 1);
-            REQUIRE(cache2["button1"]["textcolor"] == "rgb(255, 255, 0)");
+            REQUIRE(cache2["button1"]->propertyValuePairs.size() == 1);
+            REQUIRE(getValue(cache2, "button1", "textcolor") == "rgb(255, 255, 0)");
 
             auto properties = loader->load("resources/ThemeSpecialCases.txt", "name.WITH.dots");
             REQUIRE(properties.size() == 2);
             REQUIRE(properties["textcolor"] == "rgb(0, 255, 0)");
             REQUIRE(properties["backgroundcolor"] == "rgb(255, 255, 255)");
-            REQUIRE(propertyCache.size() == 2);
+            REQUIRE(renderersCache.size() == 2);
+            REQUIRE(propertyCache.size() == 1);
+            REQUIRE(propertyCache["resources/ThemeSpecialCases.txt"].size() == 1);
 
             properties = loader->load("resources/ThemeButton1.txt", "Button1");
+            REQUIRE(renderersCache.size() == 2);
             REQUIRE(propertyCache.size() == 2);
 
             properties = loader->load("resources/Black.txt", "EditBox");
+            REQUIRE(renderersCache.size() == 3);
             REQUIRE(propertyCache.size() == 3);
 
             tgui::DefaultThemeLoader::flushCache("resources/ThemeButton1.txt");
+            REQUIRE(renderersCache.size() == 2);
             REQUIRE(propertyCache.size() == 2);
 
             tgui::DefaultThemeLoader::flushCache();
+            REQUIRE(renderersCache.size() == 0);
             REQUIRE(propertyCache.size() == 0);
         }
 
@@ -164,18 +220,25 @@ TEST_CASE("[ThemeLoader]")
             REQUIRE(properties["textcolor"] == "rgb(0, 255, 0)");
             REQUIRE(properties["backgroundcolor"] == "rgb(255, 255, 255)");
             REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 1);
+            REQUIRE(tgui::DefaultThemeLoaderTest::getRenderersCache(loader).size() == 1);
 
-            auto& cache = tgui::DefaultThemeLoaderTest::getPropertiesCache(loader)["resources/ThemeSpecialCases.txt"];
+            auto& cache = tgui::DefaultThemeLoaderTest::getRenderersCache(loader)["resources/ThemeSpecialCases.txt"];
             REQUIRE(cache.size() == 4);
-            REQUIRE(cache["button1"].size() == 1);
-            REQUIRE(cache["button1"]["textcolor"] == "rgb(255, 0, 0)");
-            REQUIRE(cache["name.with.dots"].size() == 2);
-            REQUIRE(cache["name.with.dots"]["textcolor"] == "rgb(0, 255, 0)");
-            REQUIRE(cache["name.with.dots"]["backgroundcolor"] == "rgb(255, 255, 255)");
-            REQUIRE(cache["specialchars.{}=:;/*#//\t\\\""].size() == 1);
-            REQUIRE(cache["specialchars.{}=:;/*#//\t\\\""]["textcolor"] == "rgba(,,,)");
-            REQUIRE(cache["label"].size() == 1);
-            REQUIRE(cache["label"]["textcolor"] == "rgb(0, 0, 255)");
+            REQUIRE(cache["button1"]->propertyValuePairs.size() == 1);
+            REQUIRE(getValue(cache, "button1", "textcolor") == "rgb(255, 0, 0)");
+            REQUIRE(cache["name.with.dots"]->propertyValuePairs.size() == 2);
+            REQUIRE(getValue(cache, "name.with.dots", "textcolor") == "rgb(0, 255, 0)");
+            REQUIRE(getValue(cache, "name.with.dots", "backgroundcolor") == "rgb(255, 255, 255)");
+            REQUIRE(cache["specialchars.{}=:;/*#//\t\\\""]->propertyValuePairs.size() == 1);
+            REQUIRE(getValue(cache, "specialchars.{}=:;/*#//\t\\\"", "textcolor") == "rgba(,,,)");
+            REQUIRE(cache["label"]->propertyValuePairs.size() == 1);
+            REQUIRE(getValue(cache, "label", "textcolor") == "rgb(0, 0, 255)");
+
+            auto& stringCache = tgui::DefaultThemeLoaderTest::getPropertiesCache(loader)["resources/ThemeSpecialCases.txt"];
+            REQUIRE(stringCache.size() == 1);
+            REQUIRE(stringCache["name.with.dots"]->size() == 2);
+            REQUIRE(stringCache["name.with.dots"]->at("textcolor") == "rgb(0, 255, 0)");
+            REQUIRE(stringCache["name.with.dots"]->at("backgroundcolor") == "rgb(255, 255, 255)");
 
             properties = loader->load("resources/Black.txt", "EditBox");
             REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 2);
@@ -188,5 +251,45 @@ TEST_CASE("[ThemeLoader]")
             tgui::DefaultThemeLoader::flushCache();
             REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 0);
         }
+
+        SECTION("properties remain valid after flush")
+        {
+            const auto& properties = loader->load("resources/ThemeSpecialCases.txt", "name.WITH.dots");
+            tgui::DefaultThemeLoader::flushCache();
+            REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 0);
+            REQUIRE(properties.size() == 2);
+            REQUIRE(properties.at("textcolor") == "rgb(0, 255, 0)");
+
+            // Reloading the unchanged file returns the same properties again
+            REQUIRE(&loader->load("resources/ThemeSpecialCases.txt", "name.WITH.dots") == &properties);
+            tgui::DefaultThemeLoader::flushCache();
+        }
+
+        SECTION("flushed while loading on other threads")
+        {
+            const auto loadRepeatedly = [loader]
+                {
+                    for (unsigned int i = 0; i < 200; ++i)
+                    {
+                        const auto properties = loader->load("resources/ThemeSpecialCases.txt", "name.WITH.dots");
+                        if ((properties.size() != 2) || (properties.at("textcolor") != "rgb(0, 255, 0)"))
+                            return false;
+
+                        loader->preload("resources/ThemeButton1.txt");
+                        if (loader->getSectionNames("resources/ThemeButton1.txt").size() != 1)
+                            return false;
+                    }
+                    return true;
+                };
+
+            auto result1 = std::async(std::launch::async, loadRepeatedly);
+            auto result2 = std::async(std::launch::async, loadRepeatedly);
+            for (unsigned int i = 0; i < 200; ++i)
+                tgui::DefaultThemeLoader::flushCache();
+
+            REQUIRE(result1.get());
+            REQUIRE(result2.get());
+            tgui::DefaultThemeLoader::flushCache();
+        }
     }
 }
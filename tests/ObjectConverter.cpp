@@ -0,0 +1,183 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/ObjectConverter.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    bool countAllocations = false;
+    unsigned int allocationCount = 0;
+}
+
+// Replace the global allocation functions to be able to count the allocations made by ObjectConverter
+void* operator new(std::size_t size)
+{
+    if (countAllocations)
+        allocationCount++;
+
+    void* ptr = std::malloc(size ? size : 1);
+    if (!ptr)
+        throw std::bad_alloc{};
+
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+    template <typename Func>
+    unsigned int getAllocationCount(Func func)
+    {
+        allocationCount = 0;
+        countAllocations = true;
+        func();
+        countAllocations = false;
+        return allocationCount;
+    }
+}
+
+TEST_CASE("[ObjectConverter]")
+{
+    SECTION("Storing values")
+    {
+        REQUIRE(tgui::ObjectConverter{}.getType() == tgui::ObjectConverter::Type::None);
+        REQUIRE(tgui::ObjectConverter{sf::String{"text"}}.getString() == "text");
+        REQUIRE(tgui::ObjectConverter{sf::Color::Red}.getColor() == sf::Color::Red);
+        REQUIRE(tgui::ObjectConverter{5.f}.getNumber() == 5.f);
+        REQUIRE(tgui::ObjectConverter{tgui::Layout{20}}.getLayout().getValue() == 20);
+        REQUIRE((tgui::ObjectConverter{tgui::Outline{1, 2, 3, 4}}.getOutline() == tgui::Outline(1, 2, 3, 4)));
+        REQUIRE(tgui::ObjectConverter{sf::Text::Bold}.getTextStyle() == sf::Text::Bold);
+
+        auto data = tgui::RendererData::create();
+        REQUIRE(tgui::ObjectConverter{data}.getRenderer() == data);
+    }
+
+    SECTION("Deserializing values")
+    {
+        tgui::ObjectConverter color{sf::String{"Blue"}};
+        REQUIRE(color.getColor() == sf::Color::Blue);
+        REQUIRE(color.getType() == tgui::ObjectConverter::Type::Color);
+        REQUIRE(color.getString() == "Blue");
+
+        tgui::ObjectConverter number{sf::String{"3"}};
+        REQUIRE(number.getNumber() == 3);
+        REQUIRE(number.getType() == tgui::ObjectConverter::Type::Number);
+        REQUIRE(number.getLayout().getValue() == 3);
+        REQUIRE(number.getType() == tgui::ObjectConverter::Type::Layout);
+
+        tgui::ObjectConverter outline{sf::String{"(1, 2, 3, 4)"}};
+        REQUIRE((outline.getOutline() == tgui::Outline(1, 2, 3, 4)));
+
+        tgui::ObjectConverter renderer{sf::String{"{\nTextColor = Red;\n}"}};
+        REQUIRE(renderer.getRenderer()->propertyValuePairs["textcolor"].getColor() == sf::Color::Red);
+        REQUIRE(renderer.getType() == tgui::ObjectConverter::Type::RendererData);
+    }
+
+    SECTION("Copying and moving")
+    {
+        tgui::ObjectConverter color{sf::Color::Green};
+        tgui::ObjectConverter copy{color};
+        REQUIRE(copy.getColor() == sf::Color::Green);
+
+        tgui::ObjectConverter moved{std::move(copy)};
+        REQUIRE(moved.getColor() == sf::Color::Green);
+
+        tgui::ObjectConverter assigned{sf::String{"text"}};
+        assigned = color;
+        REQUIRE(assigned.getType() == tgui::ObjectConverter::Type::Color);
+        REQUIRE(assigned.getColor() == sf::Color::Green);
+
+        assigned = tgui::ObjectConverter{tgui::RendererData::create()};
+        REQUIRE(assigned.getType() == tgui::ObjectConverter::Type::RendererData);
+
+        assigned = tgui::ObjectConverter{sf::String{"text"}};
+        REQUIRE(assigned.getType() == tgui::ObjectConverter::Type::String);
+        REQUIRE(assigned.getString() == "text");
+
+        const auto& self = assigned;
+        assigned = self;
+        REQUIRE(assigned.getString() == "text");
+    }
+
+    SECTION("No allocations")
+    {
+        // The REQUIRE macros allocate themselves, so the results are only checked after counting
+        auto data = tgui::RendererData::create();
+        bool correct = false;
+
+        REQUIRE(getAllocationCount([]{ tgui::ObjectConverter value; tgui::ObjectConverter copy{value}; }) == 0);
+
+        REQUIRE((getAllocationCount([&]{
+                tgui::ObjectConverter value{sf::Color::Red};
+                tgui::ObjectConverter copy{value};
+                copy = value;
+                tgui::ObjectConverter moved{std::move(copy)};
+                correct = (moved.getColor() == sf::Color::Red);
+            }) == 0));
+        REQUIRE(correct);
+
+        REQUIRE((getAllocationCount([&]{
+                tgui::ObjectConverter value{2.f};
+                tgui::ObjectConverter copy{value};
+                correct = (copy.getNumber() == 2.f) && (copy.getLayout().getValue() == 2.f);
+            }) == 0));
+        REQUIRE(correct);
+
+        REQUIRE((getAllocationCount([&]{
+                tgui::ObjectConverter value{tgui::Outline{1, 2, 3, 4}};
+                tgui::ObjectConverter copy{value};
+                correct = (copy.getOutline() == tgui::Outline(1, 2, 3, 4));
+            }) == 0));
+        REQUIRE(correct);
+
+        REQUIRE((getAllocationCount([&]{
+                tgui::ObjectConverter value{sf::Text::Italic};
+                tgui::ObjectConverter copy{value};
+                correct = (copy.getTextStyle() == sf::Text::Italic);
+            }) == 0));
+        REQUIRE(correct);
+
+        REQUIRE((getAllocationCount([&]{
+                tgui::ObjectConverter value{data};
+                tgui::ObjectConverter copy{value};
+                copy = value;
+                correct = (copy.getRenderer() == data);
+            }) == 0));
+        REQUIRE(correct);
+    }
+}
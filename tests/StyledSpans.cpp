@@ -0,0 +1,181 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/StyledSpans.hpp>
+#include <TGUI/GlyphRunCache.hpp>
+#include <TGUI/Text.hpp>
+
+TEST_CASE("[StyledSpans]")
+{
+    tgui::StyledSpans spans;
+    REQUIRE(spans.getLength() == 0);
+    REQUIRE(spans.getSpanCount() == 0);
+
+    SECTION("Append")
+    {
+        spans.append(5);
+        spans.append(3, sf::Color::Red);
+        spans.append(2, sf::Color::Red);
+        spans.append(4, {}, sf::Text::Underlined);
+        REQUIRE(spans.getLength() == 14);
+        REQUIRE(spans.getSpanCount() == 3);
+
+        REQUIRE(spans.getSpan(0).start == 0);
+        REQUIRE(spans.getSpan(0).length == 5);
+        REQUIRE(!spans.getSpan(0).color.isSet());
+        REQUIRE(spans.getSpan(7).start == 5);
+        REQUIRE(spans.getSpan(7).length == 5);
+        REQUIRE(spans.getSpan(7).color == sf::Color::Red);
+        REQUIRE(spans.getSpan(13).style == sf::Text::Underlined);
+        REQUIRE(spans.getSpan(14).length == 0);
+
+        // Appending nothing doesn't create a span
+        spans.append(0, sf::Color::Green);
+        REQUIRE(spans.getSpanCount() == 3);
+    }
+
+    SECTION("SetStyle")
+    {
+        spans = tgui::StyledSpans{10};
+        REQUIRE(spans.getSpanCount() == 1);
+
+        spans.setStyle(2, 3, sf::Color::Red);
+        REQUIRE(spans.getSpanCount() == 3);
+        REQUIRE(spans.getSpan(1).length == 2);
+        REQUIRE(spans.getSpan(2).start == 2);
+        REQUIRE(spans.getSpan(2).length == 3);
+        REQUIRE(spans.getSpan(5).start == 5);
+        REQUIRE(spans.getSpan(5).length == 5);
+
+        // Neighboring spans that look the same are merged
+        spans.setStyle(5, 2, sf::Color::Red);
+        REQUIRE(spans.getSpanCount() == 3);
+        REQUIRE(spans.getSpan(2).length == 5);
+
+        spans.setStyle(0, 10, {});
+        REQUIRE(spans.getSpanCount() == 1);
+
+        // Characters behind the text are ignored
+        spans.setStyle(8, 5, sf::Color::Blue);
+        REQUIRE(spans.getLength() == 10);
+        REQUIRE(spans.getSpan(9).length == 2);
+
+        // Bold text is drawn as regular text
+        spans.setStyle(0, 2, {}, sf::Text::Bold | sf::Text::Italic);
+        REQUIRE(spans.getSpan(0).style == sf::Text::Italic);
+    }
+
+    SECTION("Insert and erase")
+    {
+        spans.append(4, sf::Color::Red);
+        spans.append(4, sf::Color::Green);
+
+        spans.insert(6, 2);
+        REQUIRE(spans.getLength() == 10);
+        REQUIRE(spans.getSpanCount() == 4);
+        REQUIRE(!spans.getSpan(6).color.isSet());
+        REQUIRE(spans.getSpan(6).length == 2);
+        REQUIRE(spans.getSpan(8).color == sf::Color::Green);
+        REQUIRE(spans.getSpan(8).length == 2);
+
+        spans.erase(3, 6);
+        REQUIRE(spans.getLength() == 4);
+        REQUIRE(spans.getSpanCount() == 2);
+        REQUIRE(spans.getSpan(0).length == 3);
+        REQUIRE(spans.getSpan(3).color == sf::Color::Green);
+
+        // Removing the span in between merges the spans around it
+        spans.insert(3, 1);
+        spans.setStyle(4, 1, sf::Color::Red);
+        REQUIRE(spans.getSpanCount() == 3);
+        spans.erase(3, 1);
+        REQUIRE(spans.getSpanCount() == 1);
+        REQUIRE(spans.getSpan(0).length == 4);
+        REQUIRE(spans.getSpan(0).color == sf::Color::Red);
+
+        spans.clear();
+        REQUIRE(spans.getLength() == 0);
+        REQUIRE(spans.getSpanCount() == 0);
+    }
+
+    SECTION("GetSpans")
+    {
+        spans.append(3, sf::Color::Red);
+        spans.append(3);
+        spans.append(3, sf::Color::Blue);
+
+        const auto parts = spans.getSpans(2, 5);
+        REQUIRE(parts.size() == 3);
+        REQUIRE(parts[0].start == 2);
+        REQUIRE(parts[0].length == 1);
+        REQUIRE(parts[1].start == 3);
+        REQUIRE(parts[1].length == 3);
+        REQUIRE(parts[2].start == 6);
+        REQUIRE(parts[2].length == 1);
+        REQUIRE(parts[2].color == sf::Color::Blue);
+
+        REQUIRE(spans.getSpans(9, 5).empty());
+    }
+
+    SECTION("AppendGlyphs")
+    {
+        tgui::Font font{"resources/DejaVuSans.ttf"};
+        const sf::String string = "ERROR: failed";
+        spans.append(5, sf::Color::Red);
+        spans.append(8);
+
+        std::vector<sf::Vertex> vertices;
+        const float width = spans.appendGlyphs(vertices, font, 20, string, 0, string.getSize(), {10, 5}, sf::Color::Black, 0.5f);
+        REQUIRE(width == Approx(10 + tgui::Text::getLineWidth(string, font, 20)));
+
+        // The vertices are at the same place as when the text had a single color
+        tgui::GlyphRunCache::GlyphRun singleColorVertices;
+        tgui::GlyphRunCache::appendGlyphs(singleColorVertices, font, 20, sf::Text::Regular, string, 0, string.getSize(), {10, 5}, sf::Color::Black);
+        REQUIRE(vertices.size() == singleColorVertices.size());
+        for (std::size_t i = 0; i < vertices.size(); ++i)
+        {
+            REQUIRE(vertices[i].position.x == Approx(singleColorVertices[i].position.x));
+            REQUIRE(vertices[i].position.y == Approx(singleColorVertices[i].position.y));
+        }
+
+        // Five letters of "ERROR" are red, the rest has the default color, all with the opacity applied
+        REQUIRE(vertices.front().color == sf::Color(255, 0, 0, 127));
+        REQUIRE(vertices.back().color == sf::Color(0, 0, 0, 127));
+
+        // Colors can be ignored, e.g. for selected text
+        vertices.clear();
+        spans.appendGlyphs(vertices, font, 20, string, 0, string.getSize(), {0, 0}, sf::Color::White, 1, true);
+        REQUIRE(vertices.front().color == sf::Color::White);
+
+        // Characters behind the spans get the default color
+        vertices.clear();
+        spans.clear();
+        spans.append(2, sf::Color::Green);
+        spans.appendGlyphs(vertices, font, 20, string, 0, string.getSize(), {0, 0}, sf::Color::Blue, 1);
+        REQUIRE(vertices.front().color == sf::Color::Green);
+        REQUIRE(vertices.back().color == sf::Color::Blue);
+    }
+}
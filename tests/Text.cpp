@@ -135,4 +135,36 @@ TEST_CASE("[Text]")
             REQUIRE(text.getSize().y == text3.getSize().y);
         }
     }
+
+    SECTION("Word wrap")
+    {
+        tgui::Font font{"resources/DejaVuSans.ttf"};
+
+        SECTION("Without maximum width only newlines break lines")
+        {
+            REQUIRE(tgui::Text::findLineBreaks(0, "ab\ncd\n", font, 30, false) == std::vector<std::size_t>({3, 6}));
+            REQUIRE(tgui::Text::findLineBreaks(0, "", font, 30, false).empty());
+            REQUIRE(tgui::Text::wordWrap(0, "ab\ncd\n", font, 30, false) == "ab\ncd\n");
+        }
+
+        SECTION("Every line contains at least one character")
+        {
+            REQUIRE(tgui::Text::findLineBreaks(1, "ab cd", font, 30, false) == std::vector<std::size_t>({1, 3, 4}));
+            REQUIRE(tgui::Text::findLineBreaks(1, "ab cd", font, 30, false, false) == std::vector<std::size_t>({1, 2, 3, 4}));
+            REQUIRE(tgui::Text::wordWrap(1, "ab cd", font, 30, false) == "a\nb \nc\nd");
+        }
+
+        SECTION("Words are kept together")
+        {
+            const float wordWidth = font.getFont()->getGlyph('x', 30, false).advance * 3;
+            REQUIRE(tgui::Text::findLineBreaks(wordWidth * 1.2f, "xxx xxx\n\nxxx", font, 30, false) == std::vector<std::size_t>({4, 8, 9}));
+            REQUIRE(tgui::Text::wordWrap(wordWidth * 1.2f, "xxx xxx\n\nxxx", font, 30, false) == "xxx \nxxx\n\nxxx");
+        }
+
+        SECTION("Without font")
+        {
+            REQUIRE(tgui::Text::findLineBreaks(0, "ab\ncd", nullptr, 30, false).empty());
+            REQUIRE(tgui::Text::wordWrap(0, "ab\ncd", nullptr, 30, false) == "");
+        }
+    }
 }
@@ -0,0 +1,119 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/TextLayout.hpp>
+#include <TGUI/Text.hpp>
+
+TEST_CASE("[TextLayout]")
+{
+    tgui::TextLayout layout;
+
+    SECTION("Properties")
+    {
+        REQUIRE(layout.getString() == "");
+        layout.setString("MyString");
+        REQUIRE(layout.getString() == "MyString");
+
+        layout.setCharacterSize(20);
+        REQUIRE(layout.getCharacterSize() == 20);
+
+        REQUIRE(layout.getStyle() == sf::Text::Regular);
+        layout.setStyle(sf::Text::Italic | sf::Text::Underlined);
+        REQUIRE(layout.getStyle() == (sf::Text::Italic | sf::Text::Underlined));
+
+        layout.setColor(sf::Color::Blue);
+        REQUIRE(layout.getColor() == sf::Color::Blue);
+
+        REQUIRE(layout.getOpacity() == 1);
+        layout.setOpacity(0.75);
+        REQUIRE(layout.getOpacity() == 0.75);
+
+        REQUIRE(layout.getMaximumWidth() == 0);
+        layout.setMaximumWidth(150);
+        REQUIRE(layout.getMaximumWidth() == 150);
+
+        REQUIRE(layout.getAlignment() == tgui::TextLayout::Alignment::Left);
+        layout.setAlignment(tgui::TextLayout::Alignment::Right, 200);
+        REQUIRE(layout.getAlignment() == tgui::TextLayout::Alignment::Right);
+    }
+
+    SECTION("Font")
+    {
+        std::shared_ptr<sf::Font> font = std::make_shared<sf::Font>();
+
+        REQUIRE(layout.getFont() == nullptr);
+        REQUIRE(layout.getLineCount() == 0);
+        REQUIRE(layout.getSize() == sf::Vector2f(0, 0));
+
+        layout.setFont(font);
+        REQUIRE(layout.getFont().getFont() == font);
+        REQUIRE(layout.getLineCount() == 1);
+
+        layout.setFont(nullptr);
+        REQUIRE(layout.getFont() == nullptr);
+        REQUIRE(layout.getLineCount() == 0);
+    }
+
+    SECTION("Lines")
+    {
+        tgui::Font font{"resources/DejaVuSans.ttf"};
+        layout.setFont(font);
+        layout.setCharacterSize(20);
+        layout.setString("Some text\nthat is split  \nin several lines");
+
+        tgui::Text text;
+        text.setFont(font);
+        text.setCharacterSize(20);
+
+        // Without a maximum width the lines are only split at newlines
+        text.setString("in several lines");
+        REQUIRE(layout.getLineCount() == 3);
+        REQUIRE(layout.getSize().x == text.getSize().x);
+        REQUIRE(layout.getSize().y == 3 * font.getLineSpacing(20) + tgui::Text::calculateExtraVerticalSpace(font, 20));
+
+        // The layout is recalculated when a property changes
+        layout.setMaximumWidth(text.getSize().x - 1);
+        REQUIRE(layout.getLineCount() == 4);
+        REQUIRE(layout.getSize().x < text.getSize().x);
+
+        layout.setCharacterSize(10);
+        REQUIRE(layout.getLineCount() == 3);
+
+        layout.setString("Some text");
+        REQUIRE(layout.getLineCount() == 1);
+
+        text.setCharacterSize(10);
+        text.setStyle(sf::Text::Bold);
+        text.setString("Some text");
+        layout.setStyle(sf::Text::Bold);
+        REQUIRE(layout.getSize().x == text.getSize().x);
+
+        // Alignment and color don't change the size
+        layout.setAlignment(tgui::TextLayout::Alignment::Center, 500);
+        layout.setColor(sf::Color::Red);
+        REQUIRE(layout.getSize() == text.getSize());
+    }
+}
@@ -52,4 +52,34 @@ TEST_CASE("[TextureManager]")
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
+
+    SECTION("preloadImage")
+    {
+        REQUIRE(!tgui::TextureManager::preloadImage("NonExistent.png"));
+        REQUIRE(tgui::TextureManager::preloadImage("resources/Texture1.png"));
+
+        // The preloaded image is used instead of loading the file again
+        unsigned int loadCount = 0;
+        const auto oldImageLoader = tgui::Texture::getImageLoader();
+        tgui::Texture::setImageLoader([&](const sf::String& filename){ ++loadCount; return oldImageLoader(filename); });
+
+        tgui::Texture preloadedTexture;
+        REQUIRE(tgui::TextureManager::getTexture(preloadedTexture, "resources/Texture1.png") != nullptr);
+        REQUIRE(loadCount == 0);
+
+        // Other parts of an image that is already in use are copied instead of being loaded again
+        tgui::Texture partTexture;
+        REQUIRE(tgui::TextureManager::getTexture(partTexture, "resources/Texture1.png", {0, 0, 10, 10}) != nullptr);
+        REQUIRE(loadCount == 0);
+
+        // Preloading uses the image loader as well, the image is loaded again after the preloaded one was removed
+        tgui::TextureManager::preloadImage("resources/Texture2.png");
+        REQUIRE(loadCount == 1);
+        tgui::TextureManager::clearPreloadedImages();
+        tgui::Texture clearedTexture;
+        REQUIRE(tgui::TextureManager::getTexture(clearedTexture, "resources/Texture2.png") != nullptr);
+        REQUIRE(loadCount == 2);
+
+        tgui::Texture::setImageLoader(oldImageLoader);
+    }
 }
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Widgets/EditBox.hpp>
 
@@ -277,6 +278,139 @@ TEST_CASE("[Widget]")
             REQUIRE(clonedRenderer->propertyValuePairs["font"].getFont().getId() == "resources/DejaVuSans.ttf");
         }
 
+        SECTION("Shared default renderer")
+        {
+            auto button1 = tgui::Button::create();
+            auto button2 = tgui::Button::create();
+            REQUIRE(&button1->getRenderer()->getPropertyValuePairs() == &button2->getRenderer()->getPropertyValuePairs());
+
+            button1->getRenderer()->setBorders(5);
+            REQUIRE(&button1->getRenderer()->getPropertyValuePairs() != &button2->getRenderer()->getPropertyValuePairs());
+            REQUIRE(button1->getRenderer()->getBorders() == tgui::Borders(5));
+            REQUIRE(button2->getRenderer()->getBorders() == tgui::Borders(2));
+            REQUIRE(tgui::Button::create()->getRenderer()->getBorders() == tgui::Borders(2));
+
+            // The widget still has to be informed about changes after the data was copied
+            REQUIRE_THROWS_AS(button2->getRenderer()->setProperty("NonexistentProperty", "Text"), tgui::Exception);
+            REQUIRE(button1->getRenderer()->getProperty("NonexistentProperty").getType() == tgui::ObjectConverter::Type::None);
+        }
+
+        SECTION("Shared renderer with inherited font")
+        {
+            tgui::Font font{"resources/DejaVuSans.ttf"};
+            auto panel = tgui::Panel::create();
+            panel->getRenderer()->setFont(font);
+
+            auto button1 = tgui::Button::create();
+            auto button2 = tgui::Button::create();
+            panel->add(button1);
+            panel->add(button2);
+            REQUIRE(&button1->getRenderer()->getPropertyValuePairs() == &button2->getRenderer()->getPropertyValuePairs());
+            REQUIRE(button1->getRenderer()->getFont().getFont() == font.getFont());
+
+            // Widgets that inherit another font share other data
+            auto otherPanel = tgui::Panel::create();
+            otherPanel->getRenderer()->setFont(tgui::Font{std::make_shared<sf::Font>()});
+            auto button3 = tgui::Button::create();
+            otherPanel->add(button3);
+            REQUIRE(&button3->getRenderer()->getPropertyValuePairs() != &button1->getRenderer()->getPropertyValuePairs());
+            REQUIRE(button3->getRenderer()->getFont().getFont() == otherPanel->getRenderer()->getFont().getFont());
+
+            // Changing a property still only affects a single widget
+            button1->getRenderer()->setBorders(5);
+            REQUIRE(&button1->getRenderer()->getPropertyValuePairs() != &button2->getRenderer()->getPropertyValuePairs());
+            REQUIRE(button1->getRenderer()->getFont().getFont() == font.getFont());
+            REQUIRE(button2->getRenderer()->getBorders() == tgui::Borders(2));
+        }
+
+        SECTION("Explicitly shared renderer")
+        {
+            auto button1 = tgui::Button::create();
+            auto button2 = tgui::Button::create();
+            button2->setRenderer(button1->getRenderer()->getData());
+
+            // Widgets that were given the same data keep sharing it when one of them changes a property
+            button1->getRenderer()->setBorders(5);
+            REQUIRE(button2->getRenderer()->getBorders() == tgui::Borders(5));
+            button2->getRenderer()->setTextColor(sf::Color::Red);
+            REQUIRE(button1->getRenderer()->getTextColor() == sf::Color::Red);
+
+            // A copied widget also shares its renderer with the original
+            auto button3 = tgui::Button::create();
+            auto button4 = tgui::Button::copy(button3);
+            button3->getRenderer()->setBorders(3);
+            REQUIRE(button4->getRenderer()->getBorders() == tgui::Borders(3));
+            button4->getRenderer()->setTextColor(sf::Color::Green);
+            REQUIRE(button3->getRenderer()->getTextColor() == sf::Color::Green);
+
+            // Neither of them changed the default renderer
+            REQUIRE(tgui::Button::create()->getRenderer()->getBorders() == tgui::Borders(2));
+            REQUIRE(tgui::Button::create()->getRenderer()->getTextColor() != sf::Color::Red);
+            REQUIRE(tgui::Button::create()->getRenderer()->getTextColor() != sf::Color::Green);
+        }
+
+        SECTION("Changing the data of a default renderer")
+        {
+            auto panel = tgui::Panel::create();
+            const sf::Color defaultColor = panel->getRenderer()->getBackgroundColor();
+            REQUIRE(defaultColor != sf::Color::Red);
+
+            panel->getRenderer()->getData()->propertyValuePairs["backgroundcolor"] = {sf::Color::Red};
+            REQUIRE(panel->getRenderer()->getBackgroundColor() == sf::Color::Red);
+            REQUIRE(tgui::Panel::create()->getRenderer()->getBackgroundColor() == defaultColor);
+        }
+
+        SECTION("Batched updates")
+        {
+            unsigned int propertyCalls = 0;
+            unsigned int batchCalls = 0;
+            std::set<std::string> batchProperties;
+            renderer->subscribe(&propertyCalls,
+                                [&](const std::string&){ propertyCalls++; },
+                                [&](const std::set<std::string>& properties){ batchCalls++; batchProperties = properties; });
+
+            renderer->beginUpdate();
+            renderer->setOpacity(0.5f);
+            renderer->beginUpdate();
+            renderer->setFont("resources/DejaVuSans.ttf");
+            renderer->setOpacity(0.8f);
+            renderer->endUpdate();
+            REQUIRE(batchCalls == 0);
+            renderer->endUpdate();
+
+            REQUIRE(propertyCalls == 0);
+            REQUIRE(batchCalls == 1);
+            REQUIRE(batchProperties == std::set<std::string>({"font", "opacity"}));
+            REQUIRE(renderer->getOpacity() == 0.8f);
+
+            renderer->setOpacity(1);
+            REQUIRE(propertyCalls == 1);
+            REQUIRE(batchCalls == 1);
+
+            renderer->unsubscribe(&propertyCalls);
+        }
+
+        SECTION("Data replaced during update")
+        {
+            auto data = tgui::RendererData::create();
+            tgui::WidgetRenderer observedRenderer{data};
+            unsigned int propertyCalls = 0;
+            observedRenderer.subscribe(&propertyCalls, [&](const std::string&){ propertyCalls++; });
+
+            tgui::WidgetRenderer updatedRenderer{data};
+            updatedRenderer.beginUpdate();
+            updatedRenderer.setOpacity(0.5f);
+            updatedRenderer.setData(tgui::RendererData::create());
+            updatedRenderer.endUpdate();
+
+            // The update still ended on the data on which it began
+            REQUIRE(data->updateDepth == 0);
+            REQUIRE(propertyCalls == 1);
+
+            observedRenderer.setOpacity(0.8f);
+            REQUIRE(propertyCalls == 2);
+        }
+
         // TODO: Other tests with the renderer class (e.g. sharing and copying a renderer when using multiple widgets)
     }
 
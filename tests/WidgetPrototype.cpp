@@ -0,0 +1,108 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/WidgetPrototype.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+TEST_CASE("[WidgetPrototype]")
+{
+    auto panel = tgui::Panel::create({300, 40});
+    panel->getRenderer()->setBackgroundColor(sf::Color::Red);
+
+    auto button = tgui::Button::create("Buy");
+    button->setPosition(200, 5);
+    button->getRenderer()->setTextColor(sf::Color::Green);
+    panel->add(button, "Buy");
+
+    auto label = tgui::Label::create("Item");
+    panel->add(label, "Name");
+
+    SECTION("Empty")
+    {
+        tgui::WidgetPrototype prototype;
+        REQUIRE(prototype.getWidget() == nullptr);
+        REQUIRE(prototype.instantiate() == nullptr);
+    }
+
+    SECTION("Instantiate")
+    {
+        tgui::WidgetPrototype prototype{panel};
+        REQUIRE(prototype.getWidget() != nullptr);
+        REQUIRE(prototype.getWidget() != panel);
+
+        auto instance = prototype.instantiate<tgui::Panel>();
+        REQUIRE(instance != panel);
+        REQUIRE(instance->getSize() == sf::Vector2f(300, 40));
+        REQUIRE(instance->getRenderer()->getBackgroundColor() == sf::Color::Red);
+        REQUIRE(instance->getWidgets().size() == 2);
+        REQUIRE(instance->getWidgetNames()[0] == "Buy");
+        REQUIRE(instance->getWidgetNames()[1] == "Name");
+        REQUIRE(instance->get<tgui::Button>("Buy")->getText() == "Buy");
+        REQUIRE(instance->get<tgui::Button>("Buy")->getPosition() == sf::Vector2f(200, 5));
+        REQUIRE(instance->get<tgui::Button>("Buy")->getRenderer()->getTextColor() == sf::Color::Green);
+        REQUIRE(instance->get<tgui::Label>("Name")->getText() == "Item");
+
+        // Instances share the renderer data with the prototype until they change it
+        auto instance2 = prototype.instantiate<tgui::Panel>();
+        REQUIRE(&instance->getRenderer()->getPropertyValuePairs() == &instance2->getRenderer()->getPropertyValuePairs());
+        REQUIRE(&instance->getRenderer()->getPropertyValuePairs() != &panel->getRenderer()->getPropertyValuePairs());
+
+        instance->getRenderer()->setBackgroundColor(sf::Color::Blue);
+        instance->get<tgui::Button>("Buy")->getRenderer()->setTextColor(sf::Color::Yellow);
+        REQUIRE(instance->getRenderer()->getBackgroundColor() == sf::Color::Blue);
+        REQUIRE(instance->get<tgui::Button>("Buy")->getRenderer()->getTextColor() == sf::Color::Yellow);
+        REQUIRE(instance2->getRenderer()->getBackgroundColor() == sf::Color::Red);
+        REQUIRE(instance2->get<tgui::Button>("Buy")->getRenderer()->getTextColor() == sf::Color::Green);
+        REQUIRE(prototype.instantiate<tgui::Panel>()->getRenderer()->getBackgroundColor() == sf::Color::Red);
+        REQUIRE(panel->getRenderer()->getBackgroundColor() == sf::Color::Red);
+    }
+
+    SECTION("Prototype is independent of original widget")
+    {
+        tgui::WidgetPrototype prototype{panel};
+        panel->getRenderer()->setBackgroundColor(sf::Color::Blue);
+        button->setText("Sell");
+
+        auto instance = prototype.instantiate<tgui::Panel>();
+        REQUIRE(instance->getRenderer()->getBackgroundColor() == sf::Color::Red);
+        REQUIRE(instance->get<tgui::Button>("Buy")->getText() == "Buy");
+    }
+
+    SECTION("Signals are not copied")
+    {
+        unsigned int count = 0;
+        button->connect("Pressed", [&]{ count++; });
+
+        tgui::WidgetPrototype prototype{panel};
+        auto instance = prototype.instantiate<tgui::Panel>();
+        instance->get<tgui::Button>("Buy")->connect("Pressed", [&]{ count += 10; });
+        instance->get<tgui::Button>("Buy")->leftMousePressed({205, 10});
+        instance->get<tgui::Button>("Buy")->leftMouseReleased({205, 10});
+        REQUIRE(count == 10);
+    }
+}
@@ -25,6 +25,28 @@
 #include "../Tests.hpp"
 #include <TGUI/Widgets/ChatBox.hpp>
 
+namespace
+{
+    class ChatBoxWithVertexCount : public tgui::ChatBox
+    {
+    public:
+        void drawTo(sf::RenderTarget& target) const
+        {
+            static_cast<const tgui::Widget&>(*this).draw(target, {});
+        }
+
+        std::size_t getLinesWithVertices() const
+        {
+            return static_cast<std::size_t>(std::count_if(m_lines.begin(), m_lines.end(), [](const Line& line){ return !line.vertices.empty(); }));
+        }
+
+        std::size_t getFirstVertexLine() const
+        {
+            return m_firstVertexLine;
+        }
+    };
+}
+
 TEST_CASE("[ChatBox]")
 {
     tgui::ChatBox::Ptr chatBox = tgui::ChatBox::create();
@@ -90,6 +112,39 @@ TEST_CASE("[ChatBox]")
         REQUIRE(chatBox->getLineFont(4) == font2);
     }
 
+    SECTION("Adding lines with styles")
+    {
+        chatBox->setTextColor(sf::Color::Black);
+        chatBox->setTextSize(24);
+
+        tgui::StyledSpans styles;
+        styles.append(5, sf::Color::Red);
+        styles.append(3);
+        chatBox->addLine("error: file not found", styles);
+        chatBox->addLine("Line 2", styles, sf::Color::Blue, 16);
+        chatBox->addLine("Line 3");
+        REQUIRE(chatBox->getLineAmount() == 3);
+
+        // The styles always cover the whole line
+        REQUIRE(chatBox->getLineStyles(0).getLength() == 21);
+        REQUIRE(chatBox->getLineStyles(0).getSpanCount() == 2);
+        REQUIRE(chatBox->getLineStyles(0).getSpan(0).color == sf::Color::Red);
+        REQUIRE(!chatBox->getLineStyles(0).getSpan(10).color.isSet());
+        REQUIRE(chatBox->getLineColor(0) == sf::Color::Black);
+        REQUIRE(chatBox->getLineTextSize(0) == 24);
+
+        REQUIRE(chatBox->getLineStyles(1).getLength() == 6);
+        REQUIRE(chatBox->getLineStyles(1).getSpan(4).color == sf::Color::Red);
+        REQUIRE(!chatBox->getLineStyles(1).getSpan(5).color.isSet());
+        REQUIRE(chatBox->getLineColor(1) == sf::Color::Blue);
+        REQUIRE(chatBox->getLineTextSize(1) == 16);
+
+        REQUIRE(chatBox->getLineStyles(2).getSpanCount() == 1);
+        REQUIRE(!chatBox->getLineStyles(2).getSpan(0).color.isSet());
+
+        REQUIRE(chatBox->getLineStyles(3).getLength() == 0);
+    }
+
     SECTION("Removing lines")
     {
         REQUIRE(!chatBox->removeLine(0));
@@ -109,6 +164,81 @@ TEST_CASE("[ChatBox]")
         REQUIRE(chatBox->getLineAmount() == 0);
     }
 
+    SECTION("Only visible lines have vertices")
+    {
+        auto visibleChatBox = std::make_shared<ChatBoxWithVertexCount>();
+        visibleChatBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        visibleChatBox->setSize(150, 100);
+        visibleChatBox->setTextSize(18);
+        for (unsigned int i = 0; i < 100; ++i)
+            visibleChatBox->addLine("Line " + tgui::to_string(i));
+
+        sf::RenderTexture target;
+        target.create(200, 200);
+
+        // The chat box scrolled down to the newest lines
+        visibleChatBox->drawTo(target);
+        REQUIRE(visibleChatBox->getLinesWithVertices() > 0);
+        REQUIRE(visibleChatBox->getLinesWithVertices() < 10);
+
+        for (unsigned int i = 0; i < 200; ++i)
+            visibleChatBox->mouseWheelScrolled(1, {10, 10});
+        visibleChatBox->drawTo(target);
+        REQUIRE(visibleChatBox->getLinesWithVertices() > 0);
+        REQUIRE(visibleChatBox->getLinesWithVertices() < 10);
+
+        visibleChatBox->removeLine(0);
+        visibleChatBox->drawTo(target);
+        REQUIRE(visibleChatBox->getLinesWithVertices() > 0);
+        REQUIRE(visibleChatBox->getLinesWithVertices() < 10);
+
+        visibleChatBox->removeAllLines();
+        visibleChatBox->drawTo(target);
+        REQUIRE(visibleChatBox->getLinesWithVertices() == 0);
+    }
+
+    SECTION("Visible lines keep their vertices when the line limit is reached")
+    {
+        auto visibleChatBox = std::make_shared<ChatBoxWithVertexCount>();
+        visibleChatBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        visibleChatBox->setSize(150, 100);
+        visibleChatBox->setTextSize(18);
+        visibleChatBox->setLineLimit(100);
+        for (unsigned int i = 0; i < 100; ++i)
+            visibleChatBox->addLine("Line " + tgui::to_string(i));
+
+        sf::RenderTexture target;
+        target.create(200, 200);
+        visibleChatBox->drawTo(target);
+        const std::size_t firstVertexLine = visibleChatBox->getFirstVertexLine();
+        const std::size_t linesWithVertices = visibleChatBox->getLinesWithVertices();
+        REQUIRE(firstVertexLine > 90);
+
+        // Removing the oldest line shifts the lines with vertices instead of searching them again
+        visibleChatBox->addLine("Line 100");
+        REQUIRE(visibleChatBox->getLineAmount() == 100);
+        REQUIRE(visibleChatBox->getFirstVertexLine() == firstVertexLine - 1);
+        REQUIRE(visibleChatBox->getLinesWithVertices() == linesWithVertices);
+
+        visibleChatBox->drawTo(target);
+        REQUIRE(visibleChatBox->getFirstVertexLine() == firstVertexLine);
+        REQUIRE(visibleChatBox->getLinesWithVertices() == linesWithVertices);
+
+        // Inserting lines on top shifts them the other way
+        visibleChatBox->setNewLinesBelowOthers(false);
+        for (unsigned int i = 0; i < 200; ++i)
+            visibleChatBox->mouseWheelScrolled(1, {10, 10});
+        visibleChatBox->drawTo(target);
+        REQUIRE(visibleChatBox->getFirstVertexLine() == 0);
+
+        visibleChatBox->addLine("Line 101");
+        REQUIRE(visibleChatBox->getFirstVertexLine() == 1);
+        REQUIRE(visibleChatBox->getLinesWithVertices() == linesWithVertices);
+        visibleChatBox->drawTo(target);
+        REQUIRE(visibleChatBox->getLinesWithVertices() > 0);
+        REQUIRE(visibleChatBox->getLinesWithVertices() < 10);
+    }
+
     SECTION("Line limit")
     {
         REQUIRE(chatBox->getLineLimit() == 0);
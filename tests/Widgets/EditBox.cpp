@@ -319,6 +319,45 @@ TEST_CASE("[EditBox]")
                 REQUIRE(editBox->getText() == "-.");
             }
         }
+
+        SECTION("Custom")
+        {
+            editBox->setInputValidator("[A-Z\\u00C0-\\u00DE][a-z\\u00DF-\\u00FF]*");
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText(L"Élan");
+            REQUIRE(editBox->getText() == L"Élan");
+
+            SECTION("Adding characters")
+            {
+                editBox->textEntered(L'é');
+                REQUIRE(editBox->getText() == L"Élané");
+
+                editBox->textEntered('B');
+                REQUIRE(editBox->getText() == L"Élané");
+
+                editBox->setCaretPosition(0);
+                editBox->textEntered('x');
+                REQUIRE(editBox->getText() == L"Élané");
+
+                editBox->setCaretPosition(1);
+                editBox->textEntered('x');
+                REQUIRE(editBox->getText() == L"Éxlané");
+
+                sf::Event::KeyEvent keyEvent;
+                keyEvent.code = sf::Keyboard::BackSpace;
+                keyEvent.alt = false;
+                keyEvent.control = false;
+                keyEvent.shift = false;
+                keyEvent.system = false;
+                editBox->keyPressed(keyEvent);
+                REQUIRE(editBox->getText() == L"Élané");
+
+                editBox->setCaretPosition(5);
+                editBox->textEntered('s');
+                REQUIRE(editBox->getText() == L"Élanés");
+            }
+        }
     }
 
     SECTION("Events / Signals")
@@ -27,6 +27,29 @@
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Gui.hpp>
 
+namespace
+{
+    class LabelWithRelayoutCount : public tgui::Label
+    {
+    public:
+        unsigned int batchCount = 0;
+        unsigned int relayoutCount = 0;
+
+    protected:
+        void rendererPropertiesChanged(const std::set<std::string>& properties) override
+        {
+            batchCount++;
+            tgui::Label::rendererPropertiesChanged(properties);
+        }
+
+        void updateAfterRendererChanges() override
+        {
+            relayoutCount++;
+            tgui::Label::updateAfterRendererChanges();
+        }
+    };
+}
+
 TEST_CASE("[Label]")
 {
     tgui::Label::Ptr label = tgui::Label::create();
@@ -197,6 +220,56 @@ TEST_CASE("[Label]")
             renderer->setTextStyle(sf::Text::Bold | sf::Text::Italic);
         }
 
+        SECTION("batched functions")
+        {
+            label->setText("Some text that is long enough to be split over multiple lines");
+            label->setMaximumTextWidth(100);
+
+            auto label2 = tgui::Label::copy(label);
+            label2->setRenderer(renderer->clone());
+            label2->getRenderer()->setBorders({1, 2, 3, 4});
+            label2->getRenderer()->setPadding({5, 6, 7, 8});
+            label2->getRenderer()->setTextStyle(sf::Text::Bold | sf::Text::Italic);
+
+            renderer->beginUpdate();
+            renderer->setTextColor({100, 50, 150});
+            renderer->setBackgroundColor({150, 100, 50});
+            renderer->setBorderColor({50, 150, 100});
+            renderer->setBorders({1, 2, 3, 4});
+            renderer->setPadding({5, 6, 7, 8});
+            renderer->setTextStyle(sf::Text::Bold | sf::Text::Italic);
+            renderer->endUpdate();
+
+            REQUIRE(label->getSize() == label2->getSize());
+
+            // All changes between beginUpdate and endUpdate rearrange the text only once
+            auto countingLabel = std::make_shared<LabelWithRelayoutCount>();
+            countingLabel->setText("Some text that is long enough to be split over multiple lines");
+            countingLabel->setMaximumTextWidth(100);
+            countingLabel->getRenderer()->setFont("resources/DejaVuSans.ttf");
+            REQUIRE(countingLabel->relayoutCount == 0);
+
+            auto countingRenderer = countingLabel->getRenderer();
+            countingRenderer->beginUpdate();
+            countingRenderer->setBorders({1, 2, 3, 4});
+            countingRenderer->setPadding({5, 6, 7, 8});
+            countingRenderer->setTextStyle(sf::Text::Bold | sf::Text::Italic);
+            countingRenderer->setTextColor({100, 50, 150});
+            REQUIRE(countingLabel->batchCount == 0);
+            REQUIRE(countingLabel->relayoutCount == 0);
+            countingRenderer->endUpdate();
+
+            REQUIRE(countingLabel->batchCount == 1);
+            REQUIRE(countingLabel->relayoutCount == 1);
+            REQUIRE(countingLabel->getSize() == label2->getSize());
+
+            // Without an update every change is applied on its own
+            countingRenderer->setBorders({4, 3, 2, 1});
+            countingRenderer->setPadding({8, 7, 6, 5});
+            REQUIRE(countingLabel->batchCount == 1);
+            REQUIRE(countingLabel->relayoutCount == 1);
+        }
+
         REQUIRE(renderer->getProperty("TextColor").getColor() == sf::Color(100, 50, 150));
         REQUIRE(renderer->getProperty("BackgroundColor").getColor() == sf::Color(150, 100, 50));
         REQUIRE(renderer->getProperty("BorderColor").getColor() == sf::Color(50, 150, 100));
@@ -25,6 +25,28 @@
 #include "../Tests.hpp"
 #include <TGUI/Widgets/TextBox.hpp>
 
+namespace
+{
+    class TextBoxWithLines : public tgui::TextBox
+    {
+    public:
+        const std::vector<sf::String>& getLines() const
+        {
+            return m_lines;
+        }
+
+        const std::vector<std::vector<sf::Vertex>>& getLineVertices() const
+        {
+            return m_lineVertices;
+        }
+
+        std::size_t getFirstVertexLine() const
+        {
+            return m_firstVertexLine;
+        }
+    };
+}
+
 TEST_CASE("[TextBox]")
 {
     tgui::TextBox::Ptr textBox = tgui::TextBox::create();
@@ -106,6 +128,60 @@ TEST_CASE("[TextBox]")
         }
     }
 
+    SECTION("Styled spans")
+    {
+        textBox->setText("Build started\n");
+        textBox->addText("error", sf::Color::Red);
+        textBox->addText(": missing file\n");
+        REQUIRE(textBox->getText() == "Build started\nerror: missing file\n");
+        REQUIRE(textBox->getCaretPosition() == textBox->getText().getSize());
+
+        // Appended text is wrapped in the same way as when the whole text is set at once
+        textBox->setSize(100, 60);
+        textBox->addText("A line that is long enough to be wrapped", sf::Color::Blue);
+        const std::size_t linesCount = textBox->getLinesCount();
+        const sf::String fullText = textBox->getText();
+        textBox->setText(fullText);
+        REQUIRE(textBox->getLinesCount() == linesCount);
+
+        textBox->setText("Build started\n");
+        textBox->addText("error", sf::Color::Red);
+        textBox->addText(": missing file\n");
+
+        const tgui::StyledSpans& spans = textBox->getStyledSpans();
+        REQUIRE(spans.getLength() == textBox->getText().getSize());
+        REQUIRE(spans.getSpanCount() == 3);
+        REQUIRE(spans.getSpan(14).start == 14);
+        REQUIRE(spans.getSpan(14).length == 5);
+        REQUIRE(spans.getSpan(14).color == sf::Color::Red);
+
+        // The colors stay with their characters when the text in front of them is edited
+        textBox->setCaretPosition(0);
+        textBox->textEntered('x');
+        textBox->textEntered('y');
+        REQUIRE(spans.getLength() == textBox->getText().getSize());
+        REQUIRE(spans.getSpan(16).start == 16);
+        REQUIRE(spans.getSpan(16).color == sf::Color::Red);
+
+        textBox->setSpanStyle(0, 2, sf::Color::Green, sf::Text::Underlined);
+        REQUIRE(spans.getSpan(0).length == 2);
+        REQUIRE(spans.getSpan(0).color == sf::Color::Green);
+        REQUIRE(spans.getSpan(0).style == sf::Text::Underlined);
+
+        // Text that doesn't fit anymore is not styled either
+        textBox->setMaximumCharacters(20);
+        REQUIRE(spans.getLength() == 20);
+        textBox->addText("warning", sf::Color::Yellow);
+        REQUIRE(spans.getLength() == 20);
+        REQUIRE(spans.getSpan(19).color == sf::Color::Red);
+
+        // Setting the text removes all styles
+        textBox->setText("Other text");
+        REQUIRE(spans.getLength() == 10);
+        REQUIRE(spans.getSpanCount() == 1);
+        REQUIRE(!spans.getSpan(0).color.isSet());
+    }
+
     SECTION("ReadOnly")
     {
         SECTION("Changing the read-only state")
@@ -150,7 +226,152 @@ TEST_CASE("[TextBox]")
         REQUIRE(textBox->isVerticalScrollbarPresent() == true);
     }
 
-    // TODO: setCaretPosition
+    SECTION("Editing only rewraps changed paragraphs")
+    {
+        auto editedTextBox = std::make_shared<TextBoxWithLines>();
+        editedTextBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        textBox = editedTextBox;
+
+        textBox->setSize(100, 100);
+        textBox->setTextSize(10);
+        textBox->setText("The quick brown fox jumps over the lazy dog\n\nSecond paragraph that is also long enough to wrap\nEnd");
+
+        // Compares the lines with those of a text box in which the same text was set at once
+        auto reference = std::make_shared<TextBoxWithLines>();
+        reference->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        reference->setSize(100, 100);
+        reference->setTextSize(10);
+        auto requireSameLines = [&]()
+        {
+            reference->setText(textBox->getText());
+            REQUIRE(textBox->getLinesCount() == reference->getLinesCount());
+            REQUIRE(editedTextBox->getLines() == reference->getLines());
+
+            reference->setCaretPosition(textBox->getCaretPosition());
+            REQUIRE(textBox->getCaretPosition() == reference->getCaretPosition());
+        };
+
+        sf::Event::KeyEvent event;
+        event.control = false;
+        event.alt     = false;
+        event.shift   = false;
+        event.system  = false;
+
+        const std::size_t linesBefore = textBox->getLinesCount();
+        textBox->setCaretPosition(4);
+        for (char c : std::string("very very very "))
+            textBox->textEntered(c);
+        REQUIRE(textBox->getText() == "The very very very quick brown fox jumps over the lazy dog\n\nSecond paragraph that is also long enough to wrap\nEnd");
+        REQUIRE(textBox->getCaretPosition() == 19);
+        REQUIRE(textBox->getLinesCount() > linesBefore);
+        requireSameLines();
+
+        // Joining two paragraphs by removing the newline between them
+        textBox->setCaretPosition(59);
+        event.code = sf::Keyboard::BackSpace;
+        textBox->keyPressed(event);
+        REQUIRE(textBox->getCaretPosition() == 58);
+        requireSameLines();
+
+        event.code = sf::Keyboard::Delete;
+        textBox->keyPressed(event);
+        REQUIRE(textBox->getText() == "The very very very quick brown fox jumps over the lazy dogSecond paragraph that is also long enough to wrap\nEnd");
+        requireSameLines();
+
+        // Splitting a paragraph by inserting a newline
+        textBox->setCaretPosition(textBox->getText().getSize() - 3);
+        textBox->textEntered('\n');
+        textBox->textEntered('\n');
+        REQUIRE(textBox->getText() == "The very very very quick brown fox jumps over the lazy dogSecond paragraph that is also long enough to wrap\n\n\nEnd");
+        requireSameLines();
+
+        // Removing a selection that spans several paragraphs
+        event.code = sf::Keyboard::A;
+        event.control = true;
+        textBox->keyPressed(event);
+        event.control = false;
+        event.code = sf::Keyboard::BackSpace;
+        textBox->keyPressed(event);
+        REQUIRE(textBox->getText() == "");
+        REQUIRE(textBox->getLinesCount() == 1);
+        requireSameLines();
+    }
+
+    SECTION("Selection outside the visible lines")
+    {
+        auto linesTextBox = std::make_shared<TextBoxWithLines>();
+        linesTextBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        textBox = linesTextBox;
+
+        // Only the lines that fit inside the text box get vertices, no matter how much of the text is selected
+        const auto requireOnlyVisibleVertices = [&]
+        {
+            const auto& lineVertices = linesTextBox->getLineVertices();
+            const std::size_t firstLine = linesTextBox->getFirstVertexLine();
+            REQUIRE(lineVertices.size() > 0);
+            REQUIRE(lineVertices.size() <= 7);
+
+            // Only the empty line behind the last newline has no vertices
+            std::size_t emptyLines = 0;
+            for (const auto& vertices : lineVertices)
+                emptyLines += vertices.empty() ? 1 : 0;
+            REQUIRE(emptyLines == ((firstLine + lineVertices.size() == textBox->getLinesCount()) ? 1 : 0));
+        };
+
+        textBox->setSize(100, 60);
+        textBox->setTextSize(10);
+
+        std::string text;
+        for (unsigned int i = 0; i < 50; ++i)
+            text += "Line " + tgui::to_string(i) + " is long enough to be wrapped\n";
+        textBox->setText(text);
+        REQUIRE(textBox->getLinesCount() > 100);
+
+        sf::Event::KeyEvent event;
+        event.control = true;
+        event.alt     = false;
+        event.shift   = false;
+        event.system  = false;
+        event.code    = sf::Keyboard::A;
+        textBox->keyPressed(event);
+        REQUIRE(textBox->getSelectedText() == text);
+        const std::size_t bottomLine = linesTextBox->getFirstVertexLine();
+        REQUIRE(bottomLine > 90);
+        requireOnlyVisibleVertices();
+
+        textBox->mouseWheelScrolled(20, {50, 30});
+        REQUIRE(textBox->getSelectedText() == text);
+        REQUIRE(linesTextBox->getFirstVertexLine() < bottomLine);
+        requireOnlyVisibleVertices();
+
+        event.control = false;
+        event.code = sf::Keyboard::Delete;
+        textBox->keyPressed(event);
+        REQUIRE(textBox->getText() == "");
+        REQUIRE(textBox->getSelectedText() == "");
+    }
+
+    SECTION("CaretPosition")
+    {
+        textBox->setSize(100, 60);
+        textBox->setTextSize(10);
+
+        std::string text;
+        for (unsigned int i = 0; i < 30; ++i)
+            text += "Paragraph " + tgui::to_string(i) + " is long enough to be wrapped\n" + ((i % 3 == 0) ? "\n" : "");
+        textBox->setText(text);
+        REQUIRE(textBox->getCaretPosition() == text.size());
+
+        for (std::size_t i = 0; i <= text.size(); i += 7)
+        {
+            textBox->setCaretPosition(i);
+            REQUIRE(textBox->getCaretPosition() == i);
+        }
+
+        textBox->setCaretPosition(text.size() + 10);
+        REQUIRE(textBox->getCaretPosition() == text.size());
+    }
+
     // TODO: getLinesCount
 
     SECTION("Events / Signals")
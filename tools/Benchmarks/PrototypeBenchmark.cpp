@@ -0,0 +1,112 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+#include "Benchmarks.hpp"
+#include <TGUI/TGUI.hpp>
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+    const unsigned int instanceCount = 1000;
+    const unsigned int repetitions = 20;
+
+    // Builds a list row of several widgets with shared renderers, the way widgets that use a theme are set up
+    tgui::Panel::Ptr createRow()
+    {
+        auto panelRenderer = tgui::RendererData::create({{"backgroundcolor", sf::Color{80, 80, 80}}, {"borders", tgui::Borders{1}}});
+        auto buttonRenderer = tgui::RendererData::create({{"backgroundcolor", sf::Color{60, 60, 60}}, {"textcolor", sf::Color::White}});
+        auto labelRenderer = tgui::RendererData::create({{"textcolor", sf::Color::White}});
+
+        auto row = tgui::Panel::create({400, 40});
+        row->setRenderer(panelRenderer);
+
+        auto icon = tgui::Picture::create();
+        icon->setSize(32, 32);
+        icon->setPosition(4, 4);
+        row->add(icon, "Icon");
+
+        auto name = tgui::Label::create("Item name");
+        name->setRenderer(labelRenderer);
+        name->setPosition(40, 10);
+        row->add(name, "Name");
+
+        auto price = tgui::Label::create("100 gold");
+        price->setRenderer(labelRenderer);
+        price->setPosition(200, 10);
+        row->add(price, "Price");
+
+        auto amount = tgui::EditBox::create();
+        amount->setSize(40, 24);
+        amount->setPosition(280, 8);
+        row->add(amount, "Amount");
+
+        auto buy = tgui::Button::create("Buy");
+        buy->setRenderer(buttonRenderer);
+        buy->setPosition(330, 8);
+        row->add(buy, "Buy");
+
+        return row;
+    }
+
+    // Creates the instances, changes the renderer of one of them and destroys them again.
+    // The prototype only differs from copying in how the renderers are shared, the rest of the widgets is copied in both cases.
+    template <typename Function>
+    double measure(const Function& createInstance)
+    {
+        double total = 0;
+        for (unsigned int i = 0; i < repetitions; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            {
+                std::vector<tgui::Panel::Ptr> instances;
+                instances.reserve(instanceCount);
+                for (unsigned int j = 0; j < instanceCount; ++j)
+                    instances.push_back(createInstance());
+
+                instances.front()->get<tgui::Button>("Buy")->getRenderer()->setTextColor(sf::Color::Yellow);
+            }
+            total += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        return total / repetitions;
+    }
+}
+
+void runPrototypeBenchmark()
+{
+    const auto row = createRow();
+    std::cout << "Creating, changing and destroying " << instanceCount << " rows of " << row->getWidgets().size() + 1 << " widgets" << std::endl;
+    std::cout << "(the prototype instances only share their renderers, all other widget state is copied)" << std::endl;
+
+    const double copyTime = measure([&]{ return tgui::Panel::copy(row); });
+    std::cout << "Panel::copy:                  " << copyTime << " ms" << std::endl;
+
+    const tgui::WidgetPrototype prototype{createRow()};
+    const double prototypeTime = measure([&]{ return prototype.instantiate<tgui::Panel>(); });
+    std::cout << "WidgetPrototype::instantiate: " << prototypeTime << " ms" << std::endl;
+}
@@ -0,0 +1,183 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmarks.hpp"
+#include <TGUI/TGUI.hpp>
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+    const float wrapWidth = 300;
+    const unsigned int characterSize = 16;
+    const unsigned int repetitions = 10;
+
+    // Builds about 1 MB of text with words of different lengths and paragraphs of different sizes
+    sf::String createText()
+    {
+        const char* words[] = {"a", "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "internationalization", "TGUI", "wrap"};
+        const std::size_t wordCount = sizeof(words) / sizeof(words[0]);
+
+        std::string text;
+        unsigned int seed = 1;
+        while (text.size() < 1024 * 1024)
+        {
+            seed = seed * 1103515245 + 12345;
+            text += words[(seed >> 16) % wordCount];
+
+            if ((seed >> 8) % 97 == 0)
+                text += '\n';
+            else if ((seed >> 8) % 31 == 0)
+                text += "  ";
+            else
+                text += ' ';
+        }
+
+        return text;
+    }
+
+    // The implementation of Text::wordWrap before Text::findLineBreaks existed, kept here to compare against
+    sf::String oldWordWrap(float maxWidth, const sf::String& text, tgui::Font font, unsigned int textSize, bool bold, bool dropLeadingSpace)
+    {
+        if (font == nullptr)
+            return "";
+
+        sf::String result;
+        std::size_t index = 0;
+        while (index < text.getSize())
+        {
+            const std::size_t oldIndex = index;
+
+            // Find out how many characters we can get on this line
+            float width = 0;
+            sf::Uint32 prevChar = 0;
+            for (std::size_t i = index; i < text.getSize(); ++i)
+            {
+                float charWidth;
+                const sf::Uint32 curChar = text[i];
+                if (curChar == '\n')
+                {
+                    index++;
+                    break;
+                }
+                else if (curChar == '\t')
+                    charWidth = font.getFont()->getGlyph(' ', textSize, bold).advance * 4;
+                else
+                    charWidth = font.getFont()->getGlyph(curChar, textSize, bold).advance;
+
+                const float kerning = font.getFont()->getKerning(prevChar, curChar, textSize);
+                if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
+                {
+                    width += kerning + charWidth;
+                    index++;
+                }
+                else
+                    break;
+
+                prevChar = curChar;
+            }
+
+            // Every line contains at least one character
+            if (index == oldIndex)
+                index++;
+
+            // Implement the word-wrap by removing the last few characters from the line
+            if (text[index-1] != '\n')
+            {
+                const std::size_t indexWithoutWordWrap = index;
+                if ((index < text.getSize()) && (!tgui::isWhitespace(static_cast<char>(text[index]))))
+                {
+                    std::size_t wordWrapCorrection = 0;
+                    while ((index > oldIndex) && (!tgui::isWhitespace(static_cast<char>(text[index - 1]))))
+                    {
+                        wordWrapCorrection++;
+                        index--;
+                    }
+
+                    // The word can't be split but there is no other choice, it does not fit on the line
+                    if ((index - oldIndex) <= wordWrapCorrection)
+                        index = indexWithoutWordWrap;
+                }
+            }
+
+            // If the next line starts with just a space, then the space need not be visible
+            if (dropLeadingSpace)
+            {
+                if ((index < text.getSize()) && (text[index] == ' '))
+                {
+                    if ((index == 0) || (!tgui::isWhitespace(static_cast<char>(text[index-1]))))
+                    {
+                        // But two or more spaces indicate that it is not a normal text and the spaces should not be ignored
+                        if (((index + 1 < text.getSize()) && (!tgui::isWhitespace(static_cast<char>(text[index + 1])))) || (index + 1 == text.getSize()))
+                            index++;
+                    }
+                }
+            }
+
+            result += text.substring(oldIndex, index - oldIndex);
+            if ((index < text.getSize()) && (text[index-1] != '\n'))
+                result += "\n";
+        }
+
+        return result;
+    }
+
+    // Returns the average time of the function in milliseconds
+    template <typename Function>
+    double measure(const Function& function)
+    {
+        double total = 0;
+        for (unsigned int i = 0; i < repetitions; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            function();
+            total += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        return total / repetitions;
+    }
+}
+
+void runWordWrapBenchmark(const std::string& fontFilename)
+{
+    const tgui::Font font{fontFilename};
+    const sf::String text = createText();
+    std::cout << "Wrapping " << text.getSize() << " characters at " << wrapWidth << " pixels with text size " << characterSize << std::endl;
+
+    // The glyphs are loaded in the font before measuring, so that every function gets the same cached font
+    const sf::String expected = oldWordWrap(wrapWidth, text, font, characterSize, false, true);
+    if (tgui::Text::wordWrap(wrapWidth, text, font, characterSize, false) != expected)
+        std::cout << "Warning: Text::wordWrap no longer wraps the text in the same way as the old implementation" << std::endl;
+
+    std::size_t lineCount = 0;
+    const double oldTime = measure([&]{ oldWordWrap(wrapWidth, text, font, characterSize, false, true); });
+    const double lineBreaksTime = measure([&]{ lineCount = tgui::Text::findLineBreaks(wrapWidth, text, font, characterSize, false).size(); });
+    const double wordWrapTime = measure([&]{ tgui::Text::wordWrap(wrapWidth, text, font, characterSize, false); });
+
+    std::cout << "Lines:                 " << lineCount << std::endl;
+    std::cout << "old wordWrap:          " << oldTime << " ms" << std::endl;
+    std::cout << "Text::findLineBreaks:  " << lineBreaksTime << " ms" << std::endl;
+    std::cout << "Text::wordWrap:        " << wordWrapTime << " ms" << std::endl;
+}